@@ -171,6 +171,8 @@ function(hal_add_module_dependencies MODULE_NAME)
   if(HAL_PLATFORM_WINDOWS)
     if(MODULE_NAME STREQUAL "threads")
       # Windows thread API is in kernel32.lib (linked by default)
+      # hal_lock_t parks with WaitOnAddress from synchronization.lib
+      list(APPEND HAL_LINK_LIBRARIES synchronization)
     elseif(MODULE_NAME STREQUAL "gamepad")
       # Windows gamepad uses XInput and DirectInput
       list(APPEND HAL_LINK_LIBRARIES dinput8 xinput)
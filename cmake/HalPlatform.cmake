@@ -74,6 +74,32 @@ function(hal_add_module_sources MODULE_NAME)
     if(EXISTS "${MAPPING_SOURCE}")
       list(APPEND HAL_SOURCES "${MAPPING_SOURCE}")
     endif()
+    set(COMMON_SOURCE "${CMAKE_CURRENT_SOURCE_DIR}/src/gamepad_common.c")
+    if(EXISTS "${COMMON_SOURCE}")
+      list(APPEND HAL_SOURCES "${COMMON_SOURCE}")
+    endif()
+  endif()
+
+  if(MODULE_NAME STREQUAL "threads")
+    set(POOL_SOURCE "${CMAKE_CURRENT_SOURCE_DIR}/src/threads_pool.c")
+    if(EXISTS "${POOL_SOURCE}")
+      list(APPEND HAL_SOURCES "${POOL_SOURCE}")
+    endif()
+  endif()
+
+  if(MODULE_NAME STREQUAL "filesystem")
+    set(GLOB_SOURCE "${CMAKE_CURRENT_SOURCE_DIR}/src/filesystem_glob.c")
+    if(EXISTS "${GLOB_SOURCE}")
+      list(APPEND HAL_SOURCES "${GLOB_SOURCE}")
+    endif()
+    set(BUFIO_SOURCE "${CMAKE_CURRENT_SOURCE_DIR}/src/filesystem_bufio.c")
+    if(EXISTS "${BUFIO_SOURCE}")
+      list(APPEND HAL_SOURCES "${BUFIO_SOURCE}")
+    endif()
+    set(AIO_SOURCE "${CMAKE_CURRENT_SOURCE_DIR}/src/filesystem_aio.c")
+    if(EXISTS "${AIO_SOURCE}")
+      list(APPEND HAL_SOURCES "${AIO_SOURCE}")
+    endif()
   endif()
 
   # Fallback to dummy implementation
@@ -31,6 +31,7 @@ extern "C" {
 #define HAL_ONLY_FILESYSTEM
 #include "hal.h"
 #include <stddef.h>
+#include <stdint.h>
 
 #ifndef HAL_MAX_PATH
 #if defined(__APPLE__)
@@ -247,8 +248,33 @@ bool hal_io_eof(hal_file_t file);
  @param file File stream to flush
  @return Returns true/false on success
  @brief Flush file stream
+ @discussion Same as hal_io_sync with HAL_SYNC_FULL
 */
 bool hal_io_flush(hal_file_t file);
+/*!
+ @enum hal_io_sync_t
+ @constant HAL_SYNC_NONE Only check the stream, hal_io_write is unbuffered so there is nothing to push
+ @constant HAL_SYNC_DATA Make file contents durable, metadata only when needed to read them back (fdatasync)
+ @constant HAL_SYNC_FULL Make file contents and all metadata durable (fsync)
+ @constant HAL_SYNC_RANGE Write back a byte range without flushing metadata or the disk cache (sync_file_range)
+ @discussion HAL_SYNC_RANGE falls back to HAL_SYNC_DATA where sync_file_range is unavailable. Windows has no data-only flush so HAL_SYNC_DATA and HAL_SYNC_RANGE behave like HAL_SYNC_FULL.
+*/
+typedef enum hal_io_sync {
+    HAL_SYNC_NONE = 0,
+    HAL_SYNC_DATA,
+    HAL_SYNC_FULL,
+    HAL_SYNC_RANGE
+} hal_io_sync_t;
+/*!
+ @function hal_io_sync
+ @param file File stream to sync
+ @param mode How much to make durable
+ @param offset Start of the range, HAL_SYNC_RANGE only
+ @param length Length of the range, 0 means to the end of the file, HAL_SYNC_RANGE only
+ @return Returns true/false on success
+ @brief Flush file stream to disk
+*/
+bool hal_io_sync(hal_file_t file, hal_io_sync_t mode, uint64_t offset, uint64_t length);
 /*!
  @function hal_io_valid
  @param file File stream to check
@@ -281,6 +307,289 @@ bool hal_io_write_string(hal_file_t file, const char *str);
  @brief Truncate a file stream to a specific length
 */
 bool hal_io_truncate(hal_file_t file, long size);
+/*!
+ @function hal_io_pread
+ @param file File stream to read from
+ @param buffer Buffer to read into
+ @param size Number of bytes to read
+ @param offset Position in the file to read from
+ @return Returns number of bytes read, less than size at end of file or on error
+ @brief Read from a position without using the file cursor
+ @discussion Safe to call from several threads on the same file. On POSIX the
+             cursor is untouched; on Windows it ends up after the data read.
+*/
+size_t hal_io_pread(hal_file_t file, void *buffer, size_t size, uint64_t offset);
+/*!
+ @function hal_io_pwrite
+ @param file File stream to write to
+ @param buffer Data to write
+ @param size Number of bytes to write
+ @param offset Position in the file to write to
+ @return Returns number of bytes written
+ @brief Write to a position without using the file cursor
+ @discussion See hal_io_pread
+*/
+size_t hal_io_pwrite(hal_file_t file, const void *buffer, size_t size, uint64_t offset);
+/*!
+ @typedef hal_io_vec_t
+ @field data Start of the buffer
+ @field size Size of the buffer in bytes
+ @discussion One buffer of a scatter/gather operation, same layout as struct iovec
+*/
+typedef struct hal_io_vec {
+    void *data;
+    size_t size;
+} hal_io_vec_t;
+/*!
+ @function hal_io_readv
+ @param file File stream to read from
+ @param vecs Buffers to fill, in order
+ @param count Number of buffers
+ @return Returns total number of bytes read
+ @brief Read from the file cursor into several buffers in one call
+*/
+size_t hal_io_readv(hal_file_t file, const hal_io_vec_t *vecs, size_t count);
+/*!
+ @function hal_io_writev
+ @param file File stream to write to
+ @param vecs Buffers to write, in order
+ @param count Number of buffers
+ @return Returns total number of bytes written
+ @brief Write several buffers at the file cursor in one call
+*/
+size_t hal_io_writev(hal_file_t file, const hal_io_vec_t *vecs, size_t count);
+
+/*!
+ @enum hal_aio_op_t
+ @constant HAL_AIO_READ Positional read
+ @constant HAL_AIO_WRITE Positional write
+ @constant HAL_AIO_FSYNC Flush file to disk
+*/
+typedef enum hal_aio_op {
+    HAL_AIO_READ = 0,
+    HAL_AIO_WRITE,
+    HAL_AIO_FSYNC
+} hal_aio_op_t;
+/*!
+ @enum hal_aio_backend_t
+ @constant HAL_AIO_BACKEND_SYNC Requests run on the calling thread when submitted
+ @constant HAL_AIO_BACKEND_THREADS Requests run on a pool of worker threads
+ @constant HAL_AIO_BACKEND_IO_URING Requests are handed to the kernel through io_uring (Linux)
+*/
+typedef enum hal_aio_backend {
+    HAL_AIO_BACKEND_SYNC = 0,
+    HAL_AIO_BACKEND_THREADS,
+    HAL_AIO_BACKEND_IO_URING
+} hal_aio_backend_t;
+/*!
+ @typedef hal_aio_completion_t
+ @field id Request id returned when it was queued
+ @field op Type of request
+ @field result Bytes transferred (0 for fsync), -errno on error (-GetLastError() on Windows).
+        Every backend retries short transfers, so fewer bytes than asked means
+        end of file, or an error after part of the transfer
+ @field userdata User data passed when the request was queued
+*/
+typedef struct hal_aio_completion {
+    uint64_t id;
+    hal_aio_op_t op;
+    int64_t result;
+    void *userdata;
+} hal_aio_completion_t;
+/*!
+ @typedef hal_aio_callback
+ @param completion The finished request
+ @discussion Called from hal_aio_poll on the polling thread
+*/
+typedef void(*hal_aio_callback)(const hal_aio_completion_t *completion);
+/*!
+ @typedef hal_aio_options_t
+ @field queue_depth Requests the kernel queue can hold at once, 0 for 256
+ @field threads Size of a pool started for the thread backend, 0 to share
+        hal_pool_shared
+ @field no_uring If true, never use io_uring
+*/
+typedef struct hal_aio_options {
+    unsigned int queue_depth;
+    unsigned int threads;
+    bool no_uring;
+} hal_aio_options_t;
+/*!
+ @typedef hal_aio_t
+ @discussion Opaque asynchronous I/O queue, owned by a single thread
+*/
+typedef struct hal_aio hal_aio_t;
+/*!
+ @function hal_aio_create
+ @param options Queue settings, or NULL for the defaults
+ @return Returns a new queue, NULL on error
+ @brief Create an asynchronous I/O queue
+ @discussion Uses io_uring where the kernel allows it, otherwise runs each
+             request as a task on a hal_pool, or synchronously when built
+             without the threads module. Don't poll with a timeout from a
+             task on the same pool, give such queues their own threads.
+*/
+hal_aio_t* hal_aio_create(const hal_aio_options_t *options);
+/*!
+ @function hal_aio_destroy
+ @param aio Queue to destroy
+ @brief Wait for outstanding requests and free the queue
+ @discussion Requests that were never submitted are dropped and no callbacks are called
+*/
+void hal_aio_destroy(hal_aio_t *aio);
+/*!
+ @function hal_aio_backend
+ @param aio Queue
+ @return Returns the backend the queue runs on
+ @brief Query which backend a queue ended up using
+*/
+hal_aio_backend_t hal_aio_backend(const hal_aio_t *aio);
+/*!
+ @function hal_aio_read
+ @param aio Queue
+ @param file File to read from
+ @param buffer Buffer to read into, must stay valid until the request completes
+ @param size Number of bytes to read
+ @param offset Position in the file to read from
+ @param callback Called on completion, or NULL to collect it with hal_aio_poll
+ @param userdata User data for the completion
+ @return Returns a request id, 0 on error
+ @brief Queue an asynchronous read
+ @discussion Queued requests start on the next hal_aio_submit or hal_aio_poll
+*/
+uint64_t hal_aio_read(hal_aio_t *aio, hal_file_t file, void *buffer, size_t size, uint64_t offset, hal_aio_callback callback, void *userdata);
+/*!
+ @function hal_aio_write
+ @param aio Queue
+ @param file File to write to
+ @param buffer Data to write, must stay valid until the request completes
+ @param size Number of bytes to write
+ @param offset Position in the file to write to
+ @param callback Called on completion, or NULL to collect it with hal_aio_poll
+ @param userdata User data for the completion
+ @return Returns a request id, 0 on error
+ @brief Queue an asynchronous write
+*/
+uint64_t hal_aio_write(hal_aio_t *aio, hal_file_t file, const void *buffer, size_t size, uint64_t offset, hal_aio_callback callback, void *userdata);
+/*!
+ @function hal_aio_fsync
+ @param aio Queue
+ @param file File to flush
+ @param callback Called on completion, or NULL to collect it with hal_aio_poll
+ @param userdata User data for the completion
+ @return Returns a request id, 0 on error
+ @brief Queue an asynchronous fsync
+ @discussion Not ordered against other requests, wait for writes to complete first
+*/
+uint64_t hal_aio_fsync(hal_aio_t *aio, hal_file_t file, hal_aio_callback callback, void *userdata);
+/*!
+ @function hal_aio_submit
+ @param aio Queue
+ @return Returns number of requests started
+ @brief Start every queued request in one batch
+*/
+size_t hal_aio_submit(hal_aio_t *aio);
+/*!
+ @function hal_aio_poll
+ @param aio Queue
+ @param completions Array to receive completions of requests without a callback, may be NULL
+ @param max Size of the completions array
+ @param timeout_ms Milliseconds to wait for a completion, 0 to not wait, -1 to wait forever
+ @return Returns number of completions written to the array
+ @brief Submit queued requests and reap finished ones
+ @discussion Callbacks for finished requests are called before this returns.
+             Waits until at least one request finishes, unless nothing is in flight.
+*/
+size_t hal_aio_poll(hal_aio_t *aio, hal_aio_completion_t *completions, size_t max, int timeout_ms);
+/*!
+ @function hal_aio_pending
+ @param aio Queue
+ @return Returns number of requests queued or in flight that haven't been reaped
+ @brief Count outstanding requests
+*/
+size_t hal_aio_pending(const hal_aio_t *aio);
+
+/*!
+ @typedef hal_bufio_t
+ @field file Underlying file stream, not owned
+ @discussion Buffered reader/writer over a hal_file_t, see hal_bufio_init
+*/
+typedef struct hal_bufio {
+    hal_file_t file;
+    char *buffer;
+    size_t capacity;
+    size_t start;   /* Reading: first unread byte */
+    size_t end;     /* Reading: end of buffered data, writing: end of pending data */
+    bool writing;
+    bool eof;
+} hal_bufio_t;
+/*!
+ @function hal_bufio_init
+ @param dst Pointer to receive the buffered stream
+ @param file File stream to wrap
+ @param capacity Buffer size in bytes, 0 for the default (64 KiB)
+ @return Returns true/false on success
+ @brief Wrap a file stream with a read/write buffer
+ @discussion Release with hal_bufio_destroy. Don't mix hal_io_* calls on the
+             same file while it is wrapped.
+*/
+bool hal_bufio_init(hal_bufio_t *dst, hal_file_t file, size_t capacity);
+/*!
+ @function hal_bufio_destroy
+ @param io Buffered stream
+ @return Returns false if flushing pending writes failed
+ @brief Flush pending writes and free the buffer
+ @discussion The underlying file is left open
+*/
+bool hal_bufio_destroy(hal_bufio_t *io);
+/*!
+ @function hal_bufio_read
+ @param io Buffered stream
+ @param buffer Buffer to read into
+ @param size Number of bytes to read
+ @return Returns number of bytes read, less than size at end of file
+ @brief Read from a buffered stream
+*/
+size_t hal_bufio_read(hal_bufio_t *io, void *buffer, size_t size);
+/*!
+ @function hal_bufio_read_line
+ @param io Buffered stream
+ @param line Pointer to receive the start of the line
+ @param length Pointer to receive the length of the line
+ @return Returns false at end of file
+ @brief Read a line without copying it
+ @discussion The line excludes the trailing newline (and carriage return) and is
+             not NUL terminated. It points into the stream's buffer and stays
+             valid until the next call on io. The buffer grows to fit lines
+             longer than its capacity.
+*/
+bool hal_bufio_read_line(hal_bufio_t *io, const char **line, size_t *length);
+/*!
+ @function hal_bufio_write
+ @param io Buffered stream
+ @param buffer Data to write
+ @param size Number of bytes to write
+ @return Returns number of bytes accepted
+ @brief Write to a buffered stream
+ @discussion Data reaches the file when the buffer fills or on hal_bufio_flush
+*/
+size_t hal_bufio_write(hal_bufio_t *io, const void *buffer, size_t size);
+/*!
+ @function hal_bufio_write_string
+ @param io Buffered stream
+ @param str String to write
+ @return Returns true/false on success
+ @brief Write a string to a buffered stream
+*/
+bool hal_bufio_write_string(hal_bufio_t *io, const char *str);
+/*!
+ @function hal_bufio_flush
+ @param io Buffered stream
+ @return Returns true/false on success
+ @brief Write any pending data to the file
+ @discussion Doesn't sync to disk, use hal_io_flush on io->file for that
+*/
+bool hal_bufio_flush(hal_bufio_t *io);
 
 /*!
  @function hal_file_exists
@@ -304,6 +613,7 @@ bool hal_file_delete(const char *path);
  @param write_over Write over existing files when moving
  @return Returns true/false on success
  @brief Move a file
+ @discussion Atomic on the same filesystem, without write_over an existing new_path is never replaced. Moving across filesystems falls back to copy and delete.
 */
 bool hal_file_rename(const char *old_path, const char *new_path, bool write_over);
 /*!
@@ -313,8 +623,41 @@ bool hal_file_rename(const char *old_path, const char *new_path, bool write_over
  @param write_over Write over existing files when copying
  @return Returns true/false on success
  @brief Copy a file
+ @discussion The copy keeps the original's permission bits. See hal_file_copy_ex.
 */
 bool hal_file_copy(const char *src_path, const char *dst_path, bool write_over);
+/*!
+ @enum hal_file_copy_method_t
+ @constant HAL_FILE_COPY_NONE Nothing was copied
+ @constant HAL_FILE_COPY_CLONE Copy-on-write clone sharing the original's blocks (FICLONE)
+ @constant HAL_FILE_COPY_RANGE Copied inside the kernel with copy_file_range
+ @constant HAL_FILE_COPY_SENDFILE Copied inside the kernel with sendfile
+ @constant HAL_FILE_COPY_BUFFERED Copied through a userspace buffer
+ @constant HAL_FILE_COPY_SYSTEM Copied by the operating system's own copy routine
+ @discussion Strategy used by hal_file_copy_ex
+*/
+typedef enum hal_file_copy_method {
+    HAL_FILE_COPY_NONE = 0,
+    HAL_FILE_COPY_CLONE,
+    HAL_FILE_COPY_RANGE,
+    HAL_FILE_COPY_SENDFILE,
+    HAL_FILE_COPY_BUFFERED,
+    HAL_FILE_COPY_SYSTEM
+} hal_file_copy_method_t;
+/*!
+ @function hal_file_copy_ex
+ @param src_path Path to original file
+ @param dst_path Path to copy
+ @param write_over Write over existing files when copying
+ @param method Pointer to receive the strategy that completed the copy (may be NULL)
+ @return Returns true/false on success
+ @brief Copy a file using the fastest strategy available
+ @discussion On Linux this tries a reflink clone, then copy_file_range, then
+             sendfile, then a large aligned buffer; the destination is
+             preallocated first. Other platforms use their native copy routine
+             or the buffered copy.
+*/
+bool hal_file_copy_ex(const char *src_path, const char *dst_path, bool write_over, hal_file_copy_method_t *method);
 /*!
  @function hal_file_size
  @param path Path to file
@@ -331,6 +674,62 @@ int hal_file_size(const char *path);
  @discussion Return value will need to be freed on success
 */
 const char* hal_file_read(const char *path, size_t *size);
+/*!
+ @function hal_file_write_atomic
+ @param path Path to file
+ @param data Contents to write
+ @param size Number of bytes to write
+ @return Returns true/false on success
+ @brief Replace a file's contents so readers see either the old or the new file
+ @discussion Writes a temporary file next to path, syncs its data, renames it over path and syncs the parent directory. On POSIX an existing file's permission bits are kept.
+*/
+bool hal_file_write_atomic(const char *path, const void *data, size_t size);
+
+/*!
+ @enum hal_file_map_hint_t
+ @constant HAL_FILE_MAP_NORMAL No particular access pattern
+ @constant HAL_FILE_MAP_SEQUENTIAL Mapping will be read front to back, read ahead aggressively
+ @constant HAL_FILE_MAP_RANDOM Mapping will be read in no particular order, don't read ahead
+ @constant HAL_FILE_MAP_WILLNEED Whole mapping will be needed soon, start paging it in now
+ @discussion Access pattern hints for hal_file_map
+*/
+typedef enum hal_file_map_hint {
+    HAL_FILE_MAP_NORMAL = 0,
+    HAL_FILE_MAP_SEQUENTIAL,
+    HAL_FILE_MAP_RANDOM,
+    HAL_FILE_MAP_WILLNEED
+} hal_file_map_hint_t;
+
+/*!
+ @typedef hal_file_map_t
+ @field data Start of the mapped file contents (NULL for an empty file)
+ @field size Size of the mapping in bytes
+ @discussion Read-only view of a file's contents, see hal_file_map
+*/
+typedef struct hal_file_map {
+    const void *data;
+    size_t size;
+} hal_file_map_t;
+
+/*!
+ @function hal_file_map
+ @param dst Mapping to fill
+ @param path Path to file
+ @param hint Expected access pattern
+ @return Returns true/false on success
+ @brief Map a file into memory read-only
+ @discussion Pages are loaded on first access instead of copying the whole file
+             like hal_file_read. The file must not be truncated while mapped.
+             Release with hal_file_unmap.
+*/
+bool hal_file_map(hal_file_map_t *dst, const char *path, hal_file_map_hint_t hint);
+/*!
+ @function hal_file_unmap
+ @param map Mapping to release
+ @return Returns true/false on success
+ @brief Release a mapping created by hal_file_map
+*/
+bool hal_file_unmap(hal_file_map_t *map);
 
 /*!
  @function hal_directory_exists
@@ -360,10 +759,11 @@ bool hal_directory_delete(const char *path, bool recursive, bool and_files);
 /*!
  @function hal_directory_rename
  @param old_path Path to directory
- @param new_path Path to directory to move to
- @param write_over If true, write over any existing files when copying
+ @param new_path New path for the directory
+ @param write_over If true, merge into an existing directory at new_path, writing over files
  @return Returns true/false on success
  @brief Move a directory
+ @discussion A single rename on the same filesystem. Moving across filesystems, or merging into a populated directory, falls back to hal_directory_copy_ex and deletes the original.
 */
 bool hal_directory_rename(const char *old_path, const char *new_path, bool write_over);
 /*!
@@ -376,11 +776,51 @@ bool hal_directory_rename(const char *old_path, const char *new_path, bool write
  @brief Copy a directory and contents
 */
 bool hal_directory_copy(const char *src_path, const char *dst_path, bool write_over, bool delete_src);
+/*!
+ @typedef hal_directory_options_t
+ @field threads 0 to run on hal_pool_shared, 1 to run on the calling thread
+        only, otherwise the size of a pool started for the call
+ @discussion Options for hal_directory_copy_ex, hal_directory_delete_ex and
+             hal_directory_stats
+*/
+typedef struct hal_directory_options {
+    unsigned int threads;
+} hal_directory_options_t;
+/*!
+ @function hal_directory_copy_ex
+ @param src_path Path to directory
+ @param dst_path Path to copy the directory's contents into, created if missing
+ @param write_over If true, write over any existing files when copying
+ @param delete_src If true, delete the original directory after copy succeeds
+ @param options Thread settings, or NULL for the defaults
+ @return Returns true/false on success
+ @brief Copy a directory tree in parallel
+ @discussion Directories and batches of files are submitted as tasks to the
+             threads module's pool, so files are copied concurrently, at most
+             one per worker at a time. Without the threads module this runs
+             on the calling thread.
+*/
+bool hal_directory_copy_ex(const char *src_path, const char *dst_path, bool write_over, bool delete_src, const hal_directory_options_t *options);
+/*!
+ @function hal_directory_delete_ex
+ @param path Path to directory
+ @param recursive If true, will delete child directories too
+ @param and_files If true, will delete files inside the directory
+ @param options Thread settings, or NULL for the defaults
+ @return Returns true/false on success
+ @brief Delete a directory tree in parallel
+ @discussion Same behaviour as hal_directory_delete; recursive deletes are
+             run as pool tasks, see hal_directory_copy_ex.
+*/
+bool hal_directory_delete_ex(const char *path, bool recursive, bool and_files, const hal_directory_options_t *options);
 /*!
  @function hal_directory_size
  @param path Path to directory
  @return Returns size of directory contents, -1 on error
  @brief Get the size of a directory
+ @discussion Adds hal_file_size of everything in the tree that isn't a
+             directory, so symbolic links count as the size of their target.
+             Use hal_directory_stats for 64-bit totals that don't follow links.
 */
 int hal_directory_size(const char *path);
 /*!
@@ -399,15 +839,74 @@ int hal_directory_item_count(const char *path, bool recursive);
  @brief Get the number of files inside a directory
 */
 int hal_directory_file_count(const char *path, bool recursive);
+/*!
+ @typedef hal_directory_stats_t
+ @field bytes Total size of all regular files
+ @field blocks Space allocated by the tree in 512 byte blocks, including path itself
+ @field files Number of non-directory entries
+ @field directories Number of subdirectories
+*/
+typedef struct hal_directory_stats {
+    uint64_t bytes;
+    uint64_t blocks;
+    uint64_t files;
+    uint64_t directories;
+} hal_directory_stats_t;
+/*!
+ @function hal_directory_stats
+ @param path Path to directory
+ @param dst Pointer to receive the totals
+ @param dedup_links If true, files with several hard links are only counted once
+ @param options Thread settings, or NULL for the defaults
+ @return Returns true/false on success
+ @brief Get the size and item counts of a directory tree in one pass
+ @discussion Symbolic links are counted but not followed. Subdirectories are
+             scanned in parallel, see hal_directory_copy_ex.
+*/
+bool hal_directory_stats(const char *path, hal_directory_stats_t *dst, bool dedup_links, const hal_directory_options_t *options);
 /*!
  @function hal_directory_glob
- @param pattern Glob pattern to match (supports * and **)
+ @param pattern Glob pattern to match, see hal_glob_compile
  @param count Pointer to receive the number of matches
  @return Returns array of matching paths, NULL on error or no matches
  @brief Glob a directory for files matching a pattern
- @discussion Return value and array elements must be freed by caller
+ @discussion Return value and array elements must be freed by caller. Only
+             regular files and symbolic links to them match, linked
+             directories are not descended into. Relative patterns are
+             reported with a leading "./".
 */
 const char** hal_directory_glob(const char *pattern, int *count);
+/*!
+ @typedef hal_glob_t
+ @discussion Opaque compiled glob pattern
+*/
+typedef struct hal_glob hal_glob_t;
+/*!
+ @function hal_glob_compile
+ @param pattern Glob pattern to compile
+ @return Returns a compiled pattern, NULL on error
+ @brief Parse a glob pattern once for repeated matching
+ @discussion Patterns are matched one path segment at a time. Supports * and ?
+             inside a segment, [abc], [a-z] and [!abc] classes, {a,b}
+             alternation (may be nested) and ** as a whole segment to match
+             any number of directories. Patterns expanding to more than 256
+             alternatives are rejected. Free with hal_glob_free.
+*/
+hal_glob_t* hal_glob_compile(const char *pattern);
+/*!
+ @function hal_glob_match
+ @param glob Compiled pattern
+ @param path Path to test
+ @return Returns true if path matches the pattern
+ @brief Match a path against a compiled glob
+*/
+bool hal_glob_match(const hal_glob_t *glob, const char *path);
+/*!
+ @function hal_glob_free
+ @param glob Compiled pattern
+ @brief Release a compiled glob
+*/
+void hal_glob_free(hal_glob_t *glob);
 
 /*!
  @typedef hal_dir_t
@@ -464,8 +963,13 @@ typedef int(*hal_walk_callback)(const char* path, const char* filename, void* us
  @param pattern Glob pattern to match
  @param callback Callback function for each match
  @param userdata User data to pass to callback
- @return Returns true on success
+ @return Returns true on success, including when nothing matched
  @brief Glob a pattern and call a callback for each match
+ @discussion Matches are reported as the directory tree is walked, so memory
+             use only grows with the directory depth. Returning non-zero from
+             the callback stops the walk and this returns false, as does a
+             pattern hal_glob_compile rejects (such as one expanding to more
+             than 256 alternatives). Matches follow hal_directory_glob.
 */
 bool hal_path_glob(const char *pattern, hal_glob_callback callback, void *userdata);
 /*!
@@ -479,6 +983,141 @@ bool hal_path_glob(const char *pattern, hal_glob_callback callback, void *userda
 */
 bool hal_path_walk(const char *path, bool recursive, hal_walk_callback callback, void *userdata);
 
+/*!
+ @enum hal_path_type_t
+ @constant HAL_PATH_UNKNOWN Type could not be determined
+ @constant HAL_PATH_FILE Regular file
+ @constant HAL_PATH_DIRECTORY Directory
+ @constant HAL_PATH_SYMLINK Symbolic link (not followed)
+ @constant HAL_PATH_OTHER Device, pipe, socket, etc
+*/
+typedef enum hal_path_type {
+    HAL_PATH_UNKNOWN = 0,
+    HAL_PATH_FILE,
+    HAL_PATH_DIRECTORY,
+    HAL_PATH_SYMLINK,
+    HAL_PATH_OTHER
+} hal_path_type_t;
+/*!
+ @typedef hal_path_stat_t
+ @field type Type of the entry
+ @field size Size in bytes
+ @field blocks Allocated space in 512 byte blocks
+ @field device Device the entry lives on
+ @field inode Inode/file index, unique per device
+ @field links Number of hard links
+ @field mode Permission bits
+ @field modified Last modification time, seconds since the epoch
+*/
+typedef struct hal_path_stat {
+    hal_path_type_t type;
+    uint64_t size;
+    uint64_t blocks;
+    uint64_t device;
+    uint64_t inode;
+    uint32_t links;
+    uint32_t mode;
+    int64_t modified;
+} hal_path_stat_t;
+/*!
+ @function hal_path_stat
+ @param path Path to stat
+ @param dst Pointer to receive the result
+ @param follow_links If false, report symbolic links themselves
+ @return Returns true/false on success
+ @brief Query the type, size and identity of a path
+*/
+bool hal_path_stat(const char *path, hal_path_stat_t *dst, bool follow_links);
+
+/*!
+ @enum hal_walk_flags_t
+ @constant HAL_WALK_RECURSIVE Descend into subdirectories
+ @constant HAL_WALK_DIRECTORIES Report directories to the callback, not just files
+ @constant HAL_WALK_STAT Fill in hal_walk_entry_t.stat for every entry up front
+ @constant HAL_WALK_FOLLOW_LINKS Follow symbolic links (may revisit directories)
+*/
+typedef enum hal_walk_flags {
+    HAL_WALK_RECURSIVE    = 1 << 0,
+    HAL_WALK_DIRECTORIES  = 1 << 1,
+    HAL_WALK_STAT         = 1 << 2,
+    HAL_WALK_FOLLOW_LINKS = 1 << 3
+} hal_walk_flags_t;
+/*!
+ @enum hal_walk_result_t
+ @constant HAL_WALK_CONTINUE Keep walking
+ @constant HAL_WALK_STOP Stop the walk, any other non-zero value does the same
+ @constant HAL_WALK_SKIP Don't descend into the directory just reported
+*/
+typedef enum hal_walk_result {
+    HAL_WALK_CONTINUE = 0,
+    HAL_WALK_STOP     = 1,
+    HAL_WALK_SKIP     = 2
+} hal_walk_result_t;
+/*!
+ @typedef hal_walk_entry_t
+ @field name Name of the entry inside its directory
+ @field depth Depth below the walk root, 0 for direct children
+ @field type Type of the entry, usually known without a stat
+ @field has_stat True when stat has been filled in
+ @field stat Entry metadata, see hal_walk_entry_stat
+ @discussion Only valid for the duration of the callback
+*/
+typedef struct hal_walk_entry {
+    const char *name;
+    size_t depth;
+    hal_path_type_t type;
+    bool has_stat;
+    hal_path_stat_t stat;
+    void *walker;
+} hal_walk_entry_t;
+/*!
+ @typedef hal_walk_entry_callback
+ @param entry The current entry
+ @param userdata User-provided data pointer
+ @return Return a hal_walk_result_t
+ @discussion Callback type for hal_path_walk_ex
+*/
+typedef int(*hal_walk_entry_callback)(hal_walk_entry_t *entry, void *userdata);
+/*!
+ @function hal_path_walk_ex
+ @param path Directory path to walk
+ @param flags Combination of hal_walk_flags_t
+ @param callback Callback function for each entry
+ @param userdata User data to pass to callback
+ @return Returns true on success, false on error or if the callback stopped the walk
+ @brief Walk a directory without allocating per entry
+ @discussion Directories are read relative to their parent's handle in large
+             batches and entry types come from the directory listing where the
+             filesystem provides them, so most entries cost no extra syscalls.
+             Paths are only built when hal_walk_entry_path is called.
+             Unreadable subdirectories are skipped.
+*/
+bool hal_path_walk_ex(const char *path, int flags, hal_walk_entry_callback callback, void *userdata);
+/*!
+ @function hal_walk_entry_path
+ @param entry Entry passed to the callback
+ @return Returns the full path of the entry, NULL on error
+ @brief Build the path of a walk entry
+ @discussion Do not free, valid until the callback returns or the next call to hal_walk_entry_dir
+*/
+const char* hal_walk_entry_path(hal_walk_entry_t *entry);
+/*!
+ @function hal_walk_entry_dir
+ @param entry Entry passed to the callback
+ @return Returns the path of the directory containing the entry
+ @brief Get the parent directory of a walk entry
+ @discussion Do not free, valid until the callback returns or the next call to hal_walk_entry_path
+*/
+const char* hal_walk_entry_dir(hal_walk_entry_t *entry);
+/*!
+ @function hal_walk_entry_stat
+ @param entry Entry passed to the callback
+ @return Returns the entry's metadata, NULL on error
+ @brief Stat a walk entry on demand
+ @discussion The result is cached in entry->stat
+*/
+const hal_path_stat_t* hal_walk_entry_stat(hal_walk_entry_t *entry);
+
 /*!
  @function hal_path_exists
  @param path Path to check
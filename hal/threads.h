@@ -90,6 +90,18 @@ typedef struct hal_mtx_t {
     CRITICAL_SECTION cs;
 } hal_mtx_t;
 
+/*!
+ @struct hal_rwlock_t
+ @brief Reader-writer lock structure
+*/
+typedef struct hal_rwlock_t {
+#if _WIN32_WINNT >= 0x0600
+    SRWLOCK srw;
+#else
+    CRITICAL_SECTION cs; /* No SRWLOCK before Vista, readers serialise */
+#endif
+} hal_rwlock_t;
+
 /*!
  @struct hal_once_flag
  @brief Once flag structure
@@ -136,6 +148,16 @@ typedef struct hal_mtx_t {
     pthread_mutex_t mtx;
 } hal_mtx_t;
 
+/*!
+ @struct hal_rwlock_t
+ @brief Reader-writer lock structure
+*/
+typedef struct hal_rwlock_t {
+    /* pthread_rwlock_t, allocated by hal_rwlock_init. Strict -std=c11 builds
+       don't declare the type, so the header can't hold it by value. */
+    void *rwlock;
+} hal_rwlock_t;
+
 /*!
  @struct hal_once_flag
  @brief Once flag structure
@@ -146,6 +168,8 @@ typedef struct hal_once_flag {
 #endif
 
 #include <time.h>
+#include <stdint.h>
+#include <string.h>
 
 /*!
  @struct hal_thrd_timeout
@@ -158,6 +182,16 @@ typedef struct hal_thrd_timeout {
     long nsec;
 } hal_thrd_timeout;
 
+/*!
+ @define HAL_TIME_MONOTONIC
+ @brief hal_timeout base for the monotonic clock that timed waits use
+*/
+#ifdef TIME_MONOTONIC
+#define HAL_TIME_MONOTONIC TIME_MONOTONIC
+#else
+#define HAL_TIME_MONOTONIC 2
+#endif
+
 /*!
  @enum hal_mtx_type
  @constant HAL_MTX_PLAIN Plain mutex
@@ -173,6 +207,18 @@ enum {
     HAL_MTX_RECURSIVE = 4
 };
 
+/*!
+ @enum hal_rwlock_type
+ @constant HAL_RWLOCK_PLAIN Platform default policy
+ @constant HAL_RWLOCK_PREFER_WRITER Waiting writers block new readers so a steady stream of readers can't starve them
+ @brief Reader-writer lock types
+ @discussion glibc readers win by default, macOS and the BSDs already prefer writers. SRWLOCK has no policy, so Windows ignores the type.
+*/
+enum {
+    HAL_RWLOCK_PLAIN         = 0,
+    HAL_RWLOCK_PREFER_WRITER = 1
+};
+
 /*!
  @enum hal_thrd_status
  @constant HAL_THRD_SUCCESS Success
@@ -247,9 +293,10 @@ int hal_cnd_signal(hal_cnd_t *cond);
  @function hal_cnd_timedwait
  @param cond Pointer to condition variable
  @param mtx Pointer to mutex
- @param xt Timeout
- @return Returns HAL_THRD_SUCCESS on success
+ @param xt Absolute deadline on the monotonic clock, see hal_timeout_after
+ @return Returns HAL_THRD_SUCCESS on success, HAL_THRD_BUSY if the deadline passed
  @brief Wait for a condition variable with timeout
+ @discussion Condition variables wait on the monotonic clock, so changes to the wall clock don't shorten or stretch the wait
 */
 int hal_cnd_timedwait(hal_cnd_t *cond, hal_mtx_t *mtx, const hal_thrd_timeout *xt);
 /*!
@@ -285,8 +332,8 @@ int hal_mtx_lock(hal_mtx_t *mtx);
 /*!
  @function hal_mtx_timedlock
  @param mtx Pointer to mutex
- @param xt Timeout
- @return Returns HAL_THRD_SUCCESS on success
+ @param xt Absolute deadline on the monotonic clock, see hal_timeout_after
+ @return Returns HAL_THRD_SUCCESS on success, HAL_THRD_BUSY if the deadline passed
  @brief Lock a mutex with timeout
 */
 int hal_mtx_timedlock(hal_mtx_t *mtx, const hal_thrd_timeout *xt);
@@ -305,6 +352,63 @@ int hal_mtx_trylock(hal_mtx_t *mtx);
 */
 int hal_mtx_unlock(hal_mtx_t *mtx);
 
+/*!
+ @function hal_rwlock_destroy
+ @param rwlock Pointer to reader-writer lock
+ @brief Destroy a reader-writer lock
+*/
+void hal_rwlock_destroy(hal_rwlock_t *rwlock);
+/*!
+ @function hal_rwlock_init
+ @param rwlock Pointer to reader-writer lock
+ @param type Reader-writer lock type
+ @return Returns HAL_THRD_SUCCESS on success, HAL_THRD_NOMEM if the lock couldn't be allocated
+ @brief Initialize a reader-writer lock
+*/
+int hal_rwlock_init(hal_rwlock_t *rwlock, int type);
+/*!
+ @function hal_rwlock_rdlock
+ @param rwlock Pointer to reader-writer lock
+ @return Returns HAL_THRD_SUCCESS on success
+ @brief Lock for reading, other readers can hold the lock at the same time
+*/
+int hal_rwlock_rdlock(hal_rwlock_t *rwlock);
+/*!
+ @function hal_rwlock_tryrdlock
+ @param rwlock Pointer to reader-writer lock
+ @return Returns HAL_THRD_SUCCESS on success, HAL_THRD_BUSY if a writer holds it
+ @brief Try to lock for reading
+*/
+int hal_rwlock_tryrdlock(hal_rwlock_t *rwlock);
+/*!
+ @function hal_rwlock_rdunlock
+ @param rwlock Pointer to reader-writer lock
+ @return Returns HAL_THRD_SUCCESS on success
+ @brief Release a read lock
+*/
+int hal_rwlock_rdunlock(hal_rwlock_t *rwlock);
+/*!
+ @function hal_rwlock_wrlock
+ @param rwlock Pointer to reader-writer lock
+ @return Returns HAL_THRD_SUCCESS on success
+ @brief Lock for writing, waits for every reader and writer to leave
+*/
+int hal_rwlock_wrlock(hal_rwlock_t *rwlock);
+/*!
+ @function hal_rwlock_trywrlock
+ @param rwlock Pointer to reader-writer lock
+ @return Returns HAL_THRD_SUCCESS on success, HAL_THRD_BUSY if anyone holds it
+ @brief Try to lock for writing
+*/
+int hal_rwlock_trywrlock(hal_rwlock_t *rwlock);
+/*!
+ @function hal_rwlock_wrunlock
+ @param rwlock Pointer to reader-writer lock
+ @return Returns HAL_THRD_SUCCESS on success
+ @brief Release a write lock
+*/
+int hal_rwlock_wrunlock(hal_rwlock_t *rwlock);
+
 /*!
  @function hal_thrd_create
  @param thr Pointer to thread structure
@@ -351,7 +455,7 @@ void hal_thrd_exit(int res);
 int hal_thrd_join(hal_thrd_t thr, int *res);
 /*!
  @function hal_thrd_sleep
- @param xt Sleep duration
+ @param xt Sleep duration, relative to now
  @brief Sleep the current thread
 */
 void hal_thrd_sleep(const hal_thrd_timeout *xt);
@@ -391,14 +495,603 @@ void* hal_tss_get(hal_tss_t key);
 */
 int hal_tss_set(hal_tss_t key, void *val);
 
+/*!
+ @typedef hal_pool_t
+ @brief Opaque work-stealing thread pool
+*/
+typedef struct hal_pool hal_pool_t;
+/*!
+ @typedef hal_pool_group_t
+ @brief Opaque set of pool tasks that can be waited on together
+*/
+typedef struct hal_pool_group hal_pool_group_t;
+/*!
+ @typedef hal_pool_task_t
+ @brief Pool task callback
+*/
+typedef void (*hal_pool_task_t)(void *userdata);
+/*!
+ @typedef hal_pool_range_t
+ @brief Parallel-for callback, called with a half-open slice [begin, end) of the range
+*/
+typedef void (*hal_pool_range_t)(size_t begin, size_t end, void *userdata);
+
+/*!
+ @function hal_pool_create
+ @param threads Number of worker threads, 0 for one per logical CPU
+ @return Returns a new pool, NULL on failure
+ @brief Start a work-stealing thread pool
+ @discussion Each worker owns a Chase-Lev deque. Tasks submitted from inside a task go on the submitting worker's deque, idle workers steal from the others. Tasks submitted from other threads go through a shared queue.
+*/
+hal_pool_t* hal_pool_create(unsigned int threads);
+/*!
+ @function hal_pool_destroy
+ @param pool Pool to destroy
+ @brief Run every queued task, then stop and free the pool
+*/
+void hal_pool_destroy(hal_pool_t *pool);
+/*!
+ @function hal_pool_shared
+ @return Returns the process-wide pool, NULL if it couldn't be started
+ @brief Get the pool shared by the library and the application
+ @discussion Started on first use with one worker per logical CPU and kept until
+             the process exits, so it must not be passed to hal_pool_destroy.
+             hal_directory_copy_ex, hal_directory_stats and the threaded
+             hal_aio backend run on this pool by default.
+*/
+hal_pool_t* hal_pool_shared(void);
+/*!
+ @function hal_pool_size
+ @param pool Pool to check
+ @return Returns the number of worker threads
+ @brief Get the number of workers in a pool
+*/
+unsigned int hal_pool_size(const hal_pool_t *pool);
+/*!
+ @function hal_pool_group_create
+ @param pool Pool the group's tasks run on
+ @return Returns a new group, NULL on failure
+ @brief Create a task group
+ @discussion Groups can be reused after hal_pool_wait returns
+*/
+hal_pool_group_t* hal_pool_group_create(hal_pool_t *pool);
+/*!
+ @function hal_pool_group_destroy
+ @param group Group to destroy
+ @brief Wait for a group's tasks and free it
+*/
+void hal_pool_group_destroy(hal_pool_group_t *group);
+/*!
+ @function hal_pool_submit
+ @param pool Pool to run on
+ @param group Group to add the task to, can be NULL
+ @param task Task callback
+ @param userdata Passed to the callback
+ @return Returns true/false on success
+ @brief Queue a task
+*/
+bool hal_pool_submit(hal_pool_t *pool, hal_pool_group_t *group, hal_pool_task_t task, void *userdata);
+/*!
+ @function hal_pool_wait
+ @param group Group to wait on
+ @brief Wait until every task in a group, including tasks they submit to it, has finished
+ @discussion The calling thread runs queued tasks while it waits, so waiting from inside a task can't deadlock the pool
+*/
+void hal_pool_wait(hal_pool_group_t *group);
+/*!
+ @function hal_pool_parallel_for
+ @param pool Pool to run on
+ @param begin First index
+ @param end One past the last index
+ @param grain Largest slice passed to func, 0 picks one from the pool size
+ @param func Called with slices of [begin, end)
+ @param userdata Passed to func
+ @return Returns true/false on success
+ @brief Split an index range across the pool and wait for it
+ @discussion The range is split in halves recursively so idle workers steal large pieces first
+*/
+bool hal_pool_parallel_for(hal_pool_t *pool, size_t begin, size_t end, size_t grain, hal_pool_range_t func, void *userdata);
+
 /*!
  @function hal_timeout
  @param xt Pointer to timeout structure
- @param base Base time in seconds
- @return Returns HAL_THRD_SUCCESS on success
- @brief Calculate timeout
+ @param base TIME_UTC for the wall clock, HAL_TIME_MONOTONIC for the clock used by timed waits
+ @return Returns base on success, 0 on failure
+ @brief Get the current time with nanosecond resolution
 */
 int hal_timeout(hal_thrd_timeout *xt, int base);
+/*!
+ @function hal_timeout_after
+ @param xt Pointer to timeout structure
+ @param ns Nanoseconds from now
+ @return Returns HAL_THRD_SUCCESS on success
+ @brief Build a deadline for hal_cnd_timedwait or hal_mtx_timedlock
+*/
+int hal_timeout_after(hal_thrd_timeout *xt, uint64_t ns);
+/*!
+ @function hal_time_now_ns
+ @return Returns nanoseconds on the monotonic clock
+ @brief Read the monotonic clock
+ @discussion The starting point is unspecified, only differences are meaningful. It never jumps when the wall clock is changed.
+*/
+uint64_t hal_time_now_ns(void);
+/*!
+ @function hal_time_ticks
+ @return Returns the raw monotonic counter
+ @brief Read the cheapest high-resolution monotonic counter
+ @discussion QueryPerformanceCounter on Windows, mach_absolute_time on Apple, nanoseconds elsewhere. Divide differences by hal_time_frequency.
+*/
+uint64_t hal_time_ticks(void);
+/*!
+ @function hal_time_frequency
+ @return Returns hal_time_ticks units per second
+ @brief Get the resolution of hal_time_ticks
+*/
+uint64_t hal_time_frequency(void);
+
+/*!
+ @enum hal_memory_order
+ @constant HAL_MEMORY_RELAXED No ordering, only atomicity
+ @constant HAL_MEMORY_CONSUME Treated as acquire
+ @constant HAL_MEMORY_ACQUIRE Later reads and writes can't move before this load
+ @constant HAL_MEMORY_RELEASE Earlier reads and writes can't move after this store
+ @constant HAL_MEMORY_ACQ_REL Both acquire and release, for read-modify-write operations
+ @constant HAL_MEMORY_SEQ_CST Single total order across all seq_cst operations
+ @brief Memory orders, same values as C11 memory_order
+*/
+typedef enum hal_memory_order {
+    HAL_MEMORY_RELAXED = 0,
+    HAL_MEMORY_CONSUME,
+    HAL_MEMORY_ACQUIRE,
+    HAL_MEMORY_RELEASE,
+    HAL_MEMORY_ACQ_REL,
+    HAL_MEMORY_SEQ_CST
+} hal_memory_order;
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define HAL_ATOMIC_ALIGN(n) __declspec(align(n))
+#else
+#define HAL_ATOMIC_ALIGN(n) __attribute__((aligned(n)))
+#endif
+
+/*!
+ @struct hal_atomic32_t
+ @brief Atomic 32-bit integer, only touch it through hal_atomic_*32
+*/
+typedef struct hal_atomic32 {
+    HAL_ATOMIC_ALIGN(4) volatile int32_t value;
+} hal_atomic32_t;
+/*!
+ @struct hal_atomic64_t
+ @brief Atomic 64-bit integer, only touch it through hal_atomic_*64
+*/
+typedef struct hal_atomic64 {
+    HAL_ATOMIC_ALIGN(8) volatile int64_t value;
+} hal_atomic64_t;
+/*!
+ @struct hal_atomic_ptr_t
+ @brief Atomic pointer, only touch it through hal_atomic_*_ptr
+*/
+typedef struct hal_atomic_ptr {
+    void *volatile value;
+} hal_atomic_ptr_t;
+/*!
+ @define HAL_ATOMIC_INIT
+ @brief Static initialiser for any hal_atomic type
+*/
+#define HAL_ATOMIC_INIT(v) {(v)}
+
+/*
+ The atomics are inline so they compile down to single instructions.
+ GCC and Clang use the __atomic builtins, which also work from C++.
+ MSVC has no C11 atomics, so it uses Interlocked* and barriers.
+ x86 loads already acquire, and its stores already release.
+*/
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#if defined(_M_ARM64)
+#define HAL_ATOMIC_BARRIER() __dmb(_ARM64_BARRIER_ISH)
+#elif defined(_M_ARM)
+#define HAL_ATOMIC_BARRIER() __dmb(_ARM_BARRIER_ISH)
+#else
+#define HAL_ATOMIC_BARRIER() _ReadWriteBarrier()
+#endif
+#endif
+
+/*!
+ @function hal_atomic_load32
+ @param a Atomic to read
+ @param order Memory order
+ @return Returns the current value
+ @brief Atomically load a value
+ @discussion hal_atomic_load64 and hal_atomic_load_ptr work the same way
+*/
+static inline int32_t hal_atomic_load32(const hal_atomic32_t *a, hal_memory_order order) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int32_t result;
+    result = a->value;
+    if (order != HAL_MEMORY_RELAXED)
+        HAL_ATOMIC_BARRIER();
+    return result;
+#else
+    return __atomic_load_n(&a->value, (int)order);
+#endif
+}
+/*!
+ @function hal_atomic_store32
+ @param a Atomic to write
+ @param value New value
+ @param order Memory order
+ @brief Atomically store a value
+ @discussion hal_atomic_store64 and hal_atomic_store_ptr work the same way
+*/
+static inline void hal_atomic_store32(hal_atomic32_t *a, int32_t value, hal_memory_order order) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    if (order == HAL_MEMORY_SEQ_CST)
+        _InterlockedExchange((volatile long*)&a->value, value);
+    else {
+        if (order != HAL_MEMORY_RELAXED)
+            HAL_ATOMIC_BARRIER();
+        a->value = value;
+    }
+#else
+    __atomic_store_n(&a->value, value, (int)order);
+#endif
+}
+/*!
+ @function hal_atomic_exchange32
+ @param a Atomic to write
+ @param value New value
+ @param order Memory order
+ @return Returns the previous value
+ @brief Atomically replace a value
+ @discussion hal_atomic_exchange64 and hal_atomic_exchange_ptr work the same way
+*/
+static inline int32_t hal_atomic_exchange32(hal_atomic32_t *a, int32_t value, hal_memory_order order) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    (void)order;
+    return _InterlockedExchange((volatile long*)&a->value, value);
+#else
+    return __atomic_exchange_n(&a->value, value, (int)order);
+#endif
+}
+/*!
+ @function hal_atomic_cas32
+ @param a Atomic to write
+ @param expected Value a must hold, receives the actual value on failure
+ @param desired Value to store if a holds *expected
+ @param order Memory order on success, failure uses relaxed ordering
+ @return Returns true if desired was stored
+ @brief Atomic compare-and-swap
+ @discussion hal_atomic_cas64 and hal_atomic_cas_ptr work the same way
+*/
+static inline bool hal_atomic_cas32(hal_atomic32_t *a, int32_t *expected, int32_t desired, hal_memory_order order) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    (void)order;
+    int32_t previous = _InterlockedCompareExchange((volatile long*)&a->value, desired, *expected);
+    if (previous == *expected)
+        return true;
+    *expected = previous;
+    return false;
+#else
+    return __atomic_compare_exchange_n(&a->value, expected, desired, false, (int)order, __ATOMIC_RELAXED);
+#endif
+}
+/*!
+ @function hal_atomic_fetch_add32
+ @param a Atomic to modify
+ @param value Amount to add, can be negative
+ @param order Memory order
+ @return Returns the value before the addition
+ @brief Atomically add to a value
+ @discussion hal_atomic_fetch_add64 works the same way
+*/
+static inline int32_t hal_atomic_fetch_add32(hal_atomic32_t *a, int32_t value, hal_memory_order order) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    (void)order;
+    return _InterlockedExchangeAdd((volatile long*)&a->value, value);
+#else
+    return __atomic_fetch_add(&a->value, value, (int)order);
+#endif
+}
+
+static inline int64_t hal_atomic_load64(const hal_atomic64_t *a, hal_memory_order order) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int64_t result;
+#if defined(_M_IX86)
+    /* A plain 64-bit read can tear on 32-bit x86 */
+    (void)order;
+    result = _InterlockedCompareExchange64((volatile __int64*)&a->value, 0, 0);
+#else
+    result = a->value;
+    if (order != HAL_MEMORY_RELAXED)
+        HAL_ATOMIC_BARRIER();
+#endif
+    return result;
+#else
+    return __atomic_load_n(&a->value, (int)order);
+#endif
+}
+
+static inline void hal_atomic_store64(hal_atomic64_t *a, int64_t value, hal_memory_order order) {
+#if defined(_MSC_VER) && !defined(__clang__)
+#if defined(_M_IX86)
+    (void)order;
+    _InterlockedExchange64((volatile __int64*)&a->value, value);
+#else
+    if (order == HAL_MEMORY_SEQ_CST)
+        _InterlockedExchange64((volatile __int64*)&a->value, value);
+    else {
+        if (order != HAL_MEMORY_RELAXED)
+            HAL_ATOMIC_BARRIER();
+        a->value = value;
+    }
+#endif
+#else
+    __atomic_store_n(&a->value, value, (int)order);
+#endif
+}
+
+static inline int64_t hal_atomic_exchange64(hal_atomic64_t *a, int64_t value, hal_memory_order order) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    (void)order;
+    return _InterlockedExchange64((volatile __int64*)&a->value, value);
+#else
+    return __atomic_exchange_n(&a->value, value, (int)order);
+#endif
+}
+
+static inline bool hal_atomic_cas64(hal_atomic64_t *a, int64_t *expected, int64_t desired, hal_memory_order order) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    (void)order;
+    int64_t previous = _InterlockedCompareExchange64((volatile __int64*)&a->value, desired, *expected);
+    if (previous == *expected)
+        return true;
+    *expected = previous;
+    return false;
+#else
+    return __atomic_compare_exchange_n(&a->value, expected, desired, false, (int)order, __ATOMIC_RELAXED);
+#endif
+}
+
+static inline int64_t hal_atomic_fetch_add64(hal_atomic64_t *a, int64_t value, hal_memory_order order) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    (void)order;
+    return _InterlockedExchangeAdd64((volatile __int64*)&a->value, value);
+#else
+    return __atomic_fetch_add(&a->value, value, (int)order);
+#endif
+}
+
+static inline void* hal_atomic_load_ptr(const hal_atomic_ptr_t *a, hal_memory_order order) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    void *result;
+    result = a->value;
+    if (order != HAL_MEMORY_RELAXED)
+        HAL_ATOMIC_BARRIER();
+    return result;
+#else
+    return __atomic_load_n(&a->value, (int)order);
+#endif
+}
+
+static inline void hal_atomic_store_ptr(hal_atomic_ptr_t *a, void *value, hal_memory_order order) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    if (order == HAL_MEMORY_SEQ_CST)
+        _InterlockedExchangePointer(&a->value, value);
+    else {
+        if (order != HAL_MEMORY_RELAXED)
+            HAL_ATOMIC_BARRIER();
+        a->value = value;
+    }
+#else
+    __atomic_store_n(&a->value, value, (int)order);
+#endif
+}
+
+static inline void* hal_atomic_exchange_ptr(hal_atomic_ptr_t *a, void *value, hal_memory_order order) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    (void)order;
+    return _InterlockedExchangePointer(&a->value, value);
+#else
+    return __atomic_exchange_n(&a->value, value, (int)order);
+#endif
+}
+
+static inline bool hal_atomic_cas_ptr(hal_atomic_ptr_t *a, void **expected, void *desired, hal_memory_order order) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    (void)order;
+    void *previous = _InterlockedCompareExchangePointer(&a->value, desired, *expected);
+    if (previous == *expected)
+        return true;
+    *expected = previous;
+    return false;
+#else
+    return __atomic_compare_exchange_n(&a->value, expected, desired, false, (int)order, __ATOMIC_RELAXED);
+#endif
+}
+
+/*!
+ @function hal_thread_fence
+ @param order Memory order
+ @brief Memory fence between threads
+*/
+static inline void hal_thread_fence(hal_memory_order order) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    if (order == HAL_MEMORY_SEQ_CST)
+        MemoryBarrier();
+    else if (order != HAL_MEMORY_RELAXED)
+        HAL_ATOMIC_BARRIER();
+#else
+    __atomic_thread_fence((int)order);
+#endif
+}
+/*!
+ @function hal_cpu_relax
+ @brief Hint to the CPU that this is a spin-wait loop
+ @discussion Emits pause on x86 and yield on ARM. It saves power and frees the core's resources for a sibling hyperthread.
+*/
+static inline void hal_cpu_relax(void) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    YieldProcessor();
+#elif defined(__i386__) || defined(__x86_64__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield" ::: "memory");
+#else
+    __asm__ __volatile__("" ::: "memory");
+#endif
+}
+
+/*!
+ @struct hal_lock_t
+ @brief Lightweight 4-byte mutex
+ @discussion Locking and unlocking is a single atomic instruction when uncontended. Under contention it spins briefly, then parks the thread. Parking uses a futex on Linux, WaitOnAddress on Windows and a hashed condition variable elsewhere. It is not recursive and has no timed lock, use hal_mtx_t for those. Zero-initialised memory is an unlocked lock.
+*/
+typedef struct hal_lock {
+    hal_atomic32_t state; /* 0 unlocked, 1 locked, 2 locked with sleepers */
+} hal_lock_t;
+/*!
+ @define HAL_LOCK_INIT
+ @brief Static initialiser for hal_lock_t
+*/
+#define HAL_LOCK_INIT {HAL_ATOMIC_INIT(0)}
+
+/*!
+ @function hal_lock_lock_slow
+ @param lock Lock to acquire
+ @brief Contended path of hal_lock_lock, don't call directly
+*/
+void hal_lock_lock_slow(hal_lock_t *lock);
+/*!
+ @function hal_lock_unlock_slow
+ @param lock Lock being released
+ @brief Contended path of hal_lock_unlock, don't call directly
+*/
+void hal_lock_unlock_slow(hal_lock_t *lock);
+
+/*!
+ @function hal_lock_init
+ @param lock Lock to initialise
+ @brief Initialise a lock, same as HAL_LOCK_INIT
+*/
+static inline void hal_lock_init(hal_lock_t *lock) {
+    hal_atomic_store32(&lock->state, 0, HAL_MEMORY_RELAXED);
+}
+/*!
+ @function hal_lock_trylock
+ @param lock Lock to acquire
+ @return Returns true if the lock was acquired
+ @brief Acquire a lock without waiting
+*/
+static inline bool hal_lock_trylock(hal_lock_t *lock) {
+    int32_t expected = 0;
+    return hal_atomic_cas32(&lock->state, &expected, 1, HAL_MEMORY_ACQUIRE);
+}
+/*!
+ @function hal_lock_lock
+ @param lock Lock to acquire
+ @brief Acquire a lock, waiting if another thread holds it
+*/
+static inline void hal_lock_lock(hal_lock_t *lock) {
+    if (!hal_lock_trylock(lock))
+        hal_lock_lock_slow(lock);
+}
+/*!
+ @function hal_lock_unlock
+ @param lock Lock to release
+ @brief Release a lock held by the calling thread
+*/
+static inline void hal_lock_unlock(hal_lock_t *lock) {
+    if (hal_atomic_exchange32(&lock->state, 0, HAL_MEMORY_RELEASE) == 2)
+        hal_lock_unlock_slow(lock);
+}
+
+/*!
+ @struct hal_seqlock_t
+ @brief Sequence lock for small, frequently read snapshots
+ @discussion Readers never write shared memory, so any number of them scale across cores. A reader copies the data and retries if a writer ran in the meantime. Writers never wait for readers, only for each other. The protected data must be safe to copy while it is being changed, e.g. plain structs without pointers the reader follows. Zero-initialised memory is an unlocked seqlock.
+*/
+typedef struct hal_seqlock {
+    hal_atomic32_t sequence; /* Odd while a write is in progress */
+    hal_lock_t writer;
+} hal_seqlock_t;
+/*!
+ @define HAL_SEQLOCK_INIT
+ @brief Static initialiser for hal_seqlock_t
+*/
+#define HAL_SEQLOCK_INIT {HAL_ATOMIC_INIT(0), HAL_LOCK_INIT}
+
+/*!
+ @function hal_seqlock_read_begin
+ @param seqlock Seqlock guarding the data
+ @return Returns a token for hal_seqlock_read_retry
+ @brief Start reading, waits out a write in progress
+*/
+static inline int32_t hal_seqlock_read_begin(const hal_seqlock_t *seqlock) {
+    int32_t sequence;
+    while ((sequence = hal_atomic_load32(&seqlock->sequence, HAL_MEMORY_ACQUIRE)) & 1)
+        hal_cpu_relax();
+    return sequence;
+}
+/*!
+ @function hal_seqlock_read_retry
+ @param seqlock Seqlock guarding the data
+ @param token Value returned by hal_seqlock_read_begin
+ @return Returns true if a writer ran and the copy must be discarded
+ @brief Finish reading
+*/
+static inline bool hal_seqlock_read_retry(const hal_seqlock_t *seqlock, int32_t token) {
+    hal_thread_fence(HAL_MEMORY_ACQUIRE);
+    return hal_atomic_load32(&seqlock->sequence, HAL_MEMORY_RELAXED) != token;
+}
+/*!
+ @function hal_seqlock_write_begin
+ @param seqlock Seqlock guarding the data
+ @brief Start writing, excludes other writers
+*/
+static inline void hal_seqlock_write_begin(hal_seqlock_t *seqlock) {
+    hal_lock_lock(&seqlock->writer);
+    hal_atomic_store32(&seqlock->sequence, hal_atomic_load32(&seqlock->sequence, HAL_MEMORY_RELAXED) + 1, HAL_MEMORY_RELAXED);
+    hal_thread_fence(HAL_MEMORY_RELEASE);
+}
+/*!
+ @function hal_seqlock_write_end
+ @param seqlock Seqlock guarding the data
+ @brief Finish writing and publish the new data
+*/
+static inline void hal_seqlock_write_end(hal_seqlock_t *seqlock) {
+    hal_atomic_store32(&seqlock->sequence, hal_atomic_load32(&seqlock->sequence, HAL_MEMORY_RELAXED) + 1, HAL_MEMORY_RELEASE);
+    hal_lock_unlock(&seqlock->writer);
+}
+/*!
+ @function hal_seqlock_read
+ @param seqlock Seqlock guarding the data
+ @param dst Buffer to receive the snapshot
+ @param src Shared data
+ @param size Size of the data
+ @brief Copy a consistent snapshot of shared data
+*/
+static inline void hal_seqlock_read(const hal_seqlock_t *seqlock, void *dst, const void *src, size_t size) {
+    int32_t token;
+    do {
+        token = hal_seqlock_read_begin(seqlock);
+        memcpy(dst, src, size);
+    } while (hal_seqlock_read_retry(seqlock, token));
+}
+/*!
+ @function hal_seqlock_write
+ @param seqlock Seqlock guarding the data
+ @param dst Shared data
+ @param src New contents
+ @param size Size of the data
+ @brief Replace shared data
+*/
+static inline void hal_seqlock_write(hal_seqlock_t *seqlock, void *dst, const void *src, size_t size) {
+    hal_seqlock_write_begin(seqlock);
+    memcpy(dst, src, size);
+    hal_seqlock_write_end(seqlock);
+}
 
 #ifdef __cplusplus
 }
@@ -1,11 +1,39 @@
 #!/usr/bin/env python3
 import os
 import re
+import sys
 import urllib.request
 from datetime import datetime
 
 GAMECONTROLLERDB_URL = "https://github.com/mdqinc/SDL_GameControllerDB/raw/refs/heads/master/gamecontrollerdb.txt"
-GAMEPAD_HEADER = os.path.join(os.path.dirname(__file__), "hal", "gamepad.h")
+MAPPINGS_HEADER = os.path.join(os.path.dirname(__file__), "src", "gamepad_mappings.h")
+
+# Standard layout, must match hal_gamepad_button_t / hal_gamepad_axis_t
+BUTTON_KEYS = [
+    "a", "b", "x", "y", "back", "guide", "start", "leftstick", "rightstick",
+    "leftshoulder", "rightshoulder", "dpup", "dpdown", "dpleft", "dpright",
+]
+AXIS_KEYS = ["leftx", "lefty", "rightx", "righty", "lefttrigger", "righttrigger"]
+DPAD_FIRST = BUTTON_KEYS.index("dpup")
+
+LICENSE_HEADER = """/* https://github.com/takeiteasy/hal
+
+ hal Copyright (C) 2025 George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+"""
 
 # Platform mapping from SDL to our identifiers
 PLATFORM_MAP = {
@@ -62,86 +90,145 @@ def parse_mappings(content):
             platform_key = "ios"
         
         if platform_key:
-            # Escape backslashes and quotes for C string
-            escaped = line.replace('\\', '\\\\').replace('"', '\\"')
-            mappings[platform_key].append(escaped)
+            mappings[platform_key].append(line)
     
     return mappings
 
+def leading_int(text):
+    """Mimic atoi(): parse leading digits, 0 if there are none"""
+    match = re.match(r'\d+', text)
+    return int(match.group(0)) if match else 0
+
+def parse_binding(value):
+    """Parse a binding like "b0", "a1", "h0.1", "+a2", "-a3" -> (kind, index, inverted)"""
+    inverted = False
+    if value[:1] in ('+', '-'):
+        inverted = value[0] == '-'
+        value = value[1:]
+    if value.startswith('b'):
+        return 'b', leading_int(value[1:]), inverted
+    if value.startswith('a'):
+        return 'a', leading_int(value[1:]), inverted
+    if value.startswith('h'):
+        dot = value.find('.')
+        return 'h', leading_int(value[dot + 1:]) if dot >= 0 else 0, inverted
+    return None, -1, inverted
+
+def int8(value):
+    """Indices that do not fit the int8_t tables are treated as unmapped"""
+    return value if 0 <= value <= 127 else -1
+
+def parse_mapping(line):
+    """Pre-parse a mapping line the same way parse_mapping_string() does at runtime.
+    Returns (guid_bytes, buttons, axes, hats, axis_buttons, inverted_mask) or None."""
+    fields = line.split(',')
+    if len(fields) < 3 or not re.fullmatch(r'[0-9a-fA-F]{32}', fields[0]):
+        return None
+    guid = bytes.fromhex(fields[0])
+    buttons = [-1] * len(BUTTON_KEYS)
+    axes = [-1] * len(AXIS_KEYS)
+    hats = [-1] * 4
+    axis_buttons = [-1] * len(BUTTON_KEYS)
+    inverted_mask = 0
+    for pair in fields[2:]:
+        if ':' not in pair:
+            continue
+        key, value = pair.split(':', 1)
+        kind, index, inverted = parse_binding(value)
+        if key in BUTTON_KEYS:
+            btn = BUTTON_KEYS.index(key)
+            if kind == 'b':
+                buttons[btn] = int8(index)
+            elif kind == 'a':
+                axis_buttons[btn] = int8(index)
+                if inverted:
+                    inverted_mask |= 1 << btn
+                else:
+                    inverted_mask &= ~(1 << btn)
+            elif kind == 'h' and btn >= DPAD_FIRST:
+                hats[btn - DPAD_FIRST] = int8(index)
+        elif key in AXIS_KEYS and kind == 'a':
+            axes[AXIS_KEYS.index(key)] = int8(index)
+    return guid, buttons, axes, hats, axis_buttons, inverted_mask
+
+def c_array(values):
+    return "{" + ",".join(str(v) for v in values) + "}"
+
 def generate_mapping_header(mappings):
-    """Generate C code for the embedded mappings"""
+    """Generate the private header with the embedded mappings"""
     
     lines = []
-    lines.append("/* Auto-generated by generate_mappings.py - DO NOT EDIT MANUALLY */")
+    lines.append("/* Auto-generated by mappings.py - DO NOT EDIT MANUALLY */")
     lines.append(f"/* Generated: {datetime.now().strftime('%Y-%m-%d %H:%M:%S')} */")
     lines.append("")
     lines.append("/* SDL GameControllerDB mappings - see https://github.com/mdqinc/SDL_GameControllerDB */")
     lines.append("")
+    lines.append("/* Included by gamepad_mapping.c only, after hal_gamepad_builtin_mapping_t is defined.")
+    lines.append("   hal_gamepad_builtin_table is sorted by GUID for binary search, with duplicate GUIDs")
+    lines.append("   resolved to their first occurrence. string_index points into")
+    lines.append("   hal_gamepad_builtin_mappings for hal_gamepad_get_mapping(). */")
+    lines.append("")
+    lines.append("#ifndef HAL_GAMEPAD_MAPPINGS_HEAD")
+    lines.append("#define HAL_GAMEPAD_MAPPINGS_HEAD")
+    lines.append("")
     
     # Generate per-platform mapping arrays
     for platform, entries in mappings.items():
         macro = f"HAL_PLATFORM_{platform.upper()}"
         lines.append(f"#if defined({macro})")
-        lines.append(f"static const char *hal_gamepad_builtin_mappings[] = {{")
+        lines.append(f"static const char *const hal_gamepad_builtin_mappings[] = {{")
         for entry in entries:
-            lines.append(f'    "{entry}",')
+            # Escape backslashes and quotes for C string
+            escaped = entry.replace('\\', '\\\\').replace('"', '\\"')
+            lines.append(f'    "{escaped}",')
         lines.append("    NULL")
         lines.append("};")
-        lines.append(f"static const unsigned int hal_gamepad_builtin_mapping_count = {len(entries)};")
+        
+        table = {}
+        for index, entry in enumerate(entries):
+            parsed = parse_mapping(entry)
+            if parsed is not None and parsed[0] not in table:
+                table[parsed[0]] = (index,) + parsed[1:]
+        
+        lines.append(f"static const hal_gamepad_builtin_mapping_t hal_gamepad_builtin_table[] = {{")
+        for guid in sorted(table):
+            index, buttons, axes, hats, axis_buttons, inverted_mask = table[guid]
+            lines.append("    {" + c_array(f"0x{b:02x}" for b in guid) + ",{" +
+                         ",".join([c_array(buttons), c_array(axes), c_array(hats), c_array(axis_buttons),
+                                   f"0x{inverted_mask:04x}"]) + f"}},{index}}},")
+        if not table:
+            lines.append("    {{0}}")
+        lines.append("};")
+        lines.append(f"static const unsigned int hal_gamepad_builtin_table_count = {len(table)};")
         lines.append(f"#endif /* {macro} */")
         lines.append("")
     
     # Default fallback for unsupported platforms
     lines.append("#if !defined(HAL_PLATFORM_WINDOWS) && !defined(HAL_PLATFORM_MACOS) && \\")
     lines.append("    !defined(HAL_PLATFORM_LINUX) && !defined(HAL_PLATFORM_ANDROID) && !defined(HAL_PLATFORM_IOS)")
-    lines.append("static const char *hal_gamepad_builtin_mappings[] = { NULL };")
-    lines.append("static const unsigned int hal_gamepad_builtin_mapping_count = 0;")
+    lines.append("static const char *const hal_gamepad_builtin_mappings[] = { NULL };")
+    lines.append("static const hal_gamepad_builtin_mapping_t hal_gamepad_builtin_table[] = { {{0}} };")
+    lines.append("static const unsigned int hal_gamepad_builtin_table_count = 0;")
     lines.append("#endif")
     lines.append("")
+    lines.append("#endif /* HAL_GAMEPAD_MAPPINGS_HEAD */")
+    lines.append("")
     
     return '\n'.join(lines)
 
-def update_gamepad_header(mapping_code):
-    """Update gamepad.h with the mapping code between markers"""
-    
-    begin_marker = "// BEGIN GAMEPAD MAPPINGS"
-    end_marker = "// END GAMEPAD MAPPINGS"
-    
-    with open(GAMEPAD_HEADER, 'r') as f:
-        content = f.read()
-    
-    # Check if markers exist
-    if begin_marker not in content:
-        # Insert markers and mapping code before the closing #endif
-        # Find the position just before the final #endif // HAL_GAMEPAD_HEAD
-        insert_pos = content.rfind("#ifdef __cplusplus")
-        if insert_pos == -1:
-            insert_pos = content.rfind("#endif")
-        
-        new_content = (
-            content[:insert_pos] +
-            f"\n{begin_marker}\n" +
-            mapping_code +
-            f"{end_marker}\n\n" +
-            content[insert_pos:]
-        )
-    else:
-        # Replace content between markers
-        pattern = re.compile(
-            re.escape(begin_marker) + r'.*?' + re.escape(end_marker),
-            re.DOTALL
-        )
-        replacement = f"{begin_marker}\n{mapping_code}{end_marker}"
-        new_content = pattern.sub(replacement, content)
-    
-    with open(GAMEPAD_HEADER, 'w') as f:
-        f.write(new_content)
-    
-    print(f"Updated {GAMEPAD_HEADER}")
+def write_mapping_header(mapping_code):
+    """Write the generated mappings header"""
+    with open(MAPPINGS_HEADER, 'w') as f:
+        f.write(LICENSE_HEADER + mapping_code)
+    print(f"Updated {MAPPINGS_HEADER}")
 
 def main():
-    # Download database
-    content = download_database()
+    # Use a local gamecontrollerdb.txt if given, otherwise download it
+    if len(sys.argv) > 1:
+        with open(sys.argv[1], 'r') as f:
+            content = f.read()
+    else:
+        content = download_database()
     if not content:
         print("Failed to download gamecontrollerdb.txt")
         return 1
@@ -158,8 +245,8 @@ def main():
     # Generate C code
     mapping_code = generate_mapping_header(mappings)
     
-    # Update gamepad.h
-    update_gamepad_header(mapping_code)
+    # Write src/gamepad_mappings.h
+    write_mapping_header(mapping_code)
     
     print("Done!")
     return 0
@@ -56,10 +56,12 @@ static void add_device(int32_t android_device_id) {
     device->num_buttons = 16;
     device->axis_states = calloc(sizeof(float), device->num_axes);
     device->button_states = calloc(sizeof(bool), device->num_buttons);
+    device->axis_filters = NULL;
     
     hal_gamepad_private_t *priv = malloc(sizeof(hal_gamepad_private_t));
     priv->device_id = android_device_id;
     device->private_data = priv;
+    hal_gamepad_resolve_mapping(device);
     
     devices = realloc(devices, sizeof(hal_gamepad_device_t *) * (num_devices + 1));
     devices[num_devices++] = device;
@@ -84,6 +86,7 @@ static void remove_device(hal_gamepad_device_t *device) {
     hal_gamepad_private_t *priv = device->private_data;
     free(priv);
     free(device->axis_states);
+    free(device->axis_filters);
     free(device->button_states);
     free(device);
 }
@@ -96,6 +99,7 @@ void hal_gamepad_init(void) {
     if (inited)
         return;
     
+    hal_gamepad_mapping_init();
     inited = true;
     LOGI("Gamepad subsystem initialized");
 }
@@ -162,7 +166,7 @@ void hal_gamepad_on_axis_event(int32_t device_id, int axis_id, float value) {
     
     if (device && axis_id < (int)device->num_axes) {
         float last_value = device->axis_states[axis_id];
-        if (value != last_value) {
+        if (hal_gamepad_filter_axis(device, axis_id, &value)) {
             device->axis_states[axis_id] = value;
             if (hal_gamepad_axis_cb)
                 hal_gamepad_axis_cb(device, axis_id, value, last_value, 0.0, hal_gamepad_axis_ctx);
@@ -194,4 +198,30 @@ void hal_gamepad_process_events(void) {
     /* Android events are processed via JNI callbacks from Java */
 }
 
+int hal_gamepad_poll(int timeout_ms) {
+    (void)timeout_ms;
+    return 0;
+}
+
+bool hal_gamepad_get_snapshot(hal_gamepad_device_t *device, hal_gamepad_snapshot_t *snapshot) {
+    /* State is only updated on the thread that processes events */
+    if (!device || !snapshot)
+        return false;
+    hal_gamepad_fill_snapshot(device, snapshot);
+    return true;
+}
+
+size_t hal_gamepad_drain_events(hal_gamepad_event_t *out, size_t max) {
+    /* Input is delivered through callbacks as it arrives */
+    (void)out;
+    (void)max;
+    return 0;
+}
+
+unsigned long long hal_gamepad_dropped_events(hal_gamepad_device_t *device) {
+    /* Events are not held in a bounded queue on this platform */
+    (void)device;
+    return 0;
+}
+
 #endif /* HAL_NO_GAMEPAD */
@@ -43,4 +43,26 @@ void hal_gamepad_detect_devices(void) {
 void hal_gamepad_process_events(void) {
 }
 
+int hal_gamepad_poll(int timeout_ms) {
+    (void)timeout_ms;
+    return 0;
+}
+
+bool hal_gamepad_get_snapshot(hal_gamepad_device_t *device, hal_gamepad_snapshot_t *snapshot) {
+    (void)device;
+    (void)snapshot;
+    return false;
+}
+
+size_t hal_gamepad_drain_events(hal_gamepad_event_t *out, size_t max) {
+    (void)out;
+    (void)max;
+    return 0;
+}
+
+unsigned long long hal_gamepad_dropped_events(hal_gamepad_device_t *device) {
+    (void)device;
+    return 0;
+}
+
 #endif /* HAL_NO_GAMEPAD */
@@ -0,0 +1,677 @@
+/* https://github.com/takeiteasy/hal
+
+ hal Copyright (C) 2025 George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/* Asynchronous file I/O - io_uring on Linux, hal_pool tasks elsewhere */
+
+#ifndef HAL_NO_FILESYSTEM
+#ifndef HAL_NO_THREADS
+#define HAL_AIO_THREADS
+#endif
+#include "hal/filesystem.h"
+#ifdef HAL_AIO_THREADS
+#include "hal/threads.h"
+#endif
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <unistd.h>
+#include <errno.h>
+#endif
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define HAL_AIO_URING
+#include <linux/io_uring.h>
+#include <linux/time_types.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+#endif
+
+#define HAL_AIO_DEFAULT_DEPTH 256
+
+typedef struct hal_aio_request {
+    struct hal_aio_request *next;
+    uint64_t id;
+    hal_aio_op_t op;
+    hal_file_t file;
+    void *buffer;
+    size_t size;
+    uint64_t offset;
+    int64_t result;
+    hal_aio_callback callback;
+    void *userdata;
+#ifdef HAL_AIO_URING
+    struct iovec iov;
+    size_t done;                /* Bytes moved by earlier short transfers */
+#endif
+#ifdef HAL_AIO_THREADS
+    struct hal_aio *owner;
+#endif
+} hal_aio_request_t;
+
+typedef struct hal_aio_list {
+    hal_aio_request_t *head, *tail;
+} hal_aio_list_t;
+
+#ifdef HAL_AIO_URING
+typedef struct hal_aio_uring {
+    int fd;
+    unsigned *sq_head, *sq_tail, *sq_mask, *sq_array;
+    unsigned sq_entries;
+    struct io_uring_sqe *sqes;
+    unsigned *cq_head, *cq_tail, *cq_mask;
+    struct io_uring_cqe *cqes;
+    unsigned cq_entries;
+    void *sq_map, *cq_map;
+    size_t sq_map_size, cq_map_size, sqes_size;
+    unsigned unsubmitted;       /* SQEs written but not yet passed to io_uring_enter */
+    unsigned in_kernel;         /* SQEs passed to the kernel without a reaped CQE */
+    struct __kernel_timespec timeout; /* Read by the kernel when the timeout SQE is submitted */
+} hal_aio_uring_t;
+#endif
+
+struct hal_aio {
+    hal_aio_backend_t backend;
+    uint64_t next_id;
+    size_t pending;             /* Requests queued or running, not yet delivered */
+    size_t running;             /* Requests handed to the backend, not yet collected */
+    hal_aio_list_t queued;      /* Waiting for hal_aio_submit */
+    hal_aio_list_t ready;       /* Finished, waiting for hal_aio_poll */
+    hal_aio_request_t *free_list;
+#ifdef HAL_AIO_URING
+    hal_aio_uring_t ring;
+#endif
+#ifdef HAL_AIO_THREADS
+    hal_pool_t *pool;
+    hal_pool_t *owned_pool;     /* Started for this queue, NULL when sharing */
+    hal_pool_group_t *group;
+    hal_mtx_t lock;
+    hal_cnd_t finished;
+    hal_aio_list_t done_list;   /* Filled by pool tasks, guarded by lock */
+#endif
+};
+
+static void aio_list_push(hal_aio_list_t *list, hal_aio_request_t *request) {
+    request->next = NULL;
+    if (list->tail)
+        list->tail->next = request;
+    else
+        list->head = request;
+    list->tail = request;
+}
+
+static hal_aio_request_t* aio_list_pop(hal_aio_list_t *list) {
+    hal_aio_request_t *request = list->head;
+    if (request && !(list->head = request->next))
+        list->tail = NULL;
+    return request;
+}
+
+static void aio_list_append(hal_aio_list_t *dst, hal_aio_list_t *src) {
+    if (!src->head)
+        return;
+    if (dst->tail)
+        dst->tail->next = src->head;
+    else
+        dst->head = src->head;
+    dst->tail = src->tail;
+    src->head = src->tail = NULL;
+}
+
+/* Blocking read/write loop, returns bytes moved or a negative error like io_uring.
+   Errors after a partial transfer report the partial count, as the kernel does. */
+#if defined(_WIN32) || defined(_WIN64)
+static int64_t aio_transfer(hal_aio_request_t *request) {
+    size_t total = 0;
+    while (total < request->size) {
+        OVERLAPPED overlapped;
+        memset(&overlapped, 0, sizeof(overlapped));
+        uint64_t position = request->offset + total;
+        overlapped.Offset = (DWORD)position;
+        overlapped.OffsetHigh = (DWORD)(position >> 32);
+        size_t remaining = request->size - total;
+        DWORD chunk = remaining > 0x40000000 ? 0x40000000 : (DWORD)remaining;
+        DWORD moved = 0;
+        BOOL ok = request->op == HAL_AIO_READ ?
+            ReadFile((HANDLE)request->file.fd, (char*)request->buffer + total, chunk, &moved, &overlapped) :
+            WriteFile((HANDLE)request->file.fd, (const char*)request->buffer + total, chunk, &moved, &overlapped);
+        if (!ok) {
+            DWORD error = GetLastError();
+            if (error == ERROR_HANDLE_EOF)
+                break;
+            return total ? (int64_t)total : -(int64_t)error;
+        }
+        if (!moved)
+            break;
+        total += moved;
+    }
+    return (int64_t)total;
+}
+
+static int64_t aio_fsync(hal_aio_request_t *request) {
+    return FlushFileBuffers((HANDLE)request->file.fd) ? 0 : -(int64_t)GetLastError();
+}
+#else
+static int64_t aio_transfer(hal_aio_request_t *request) {
+    size_t total = 0;
+    while (total < request->size) {
+        ssize_t moved = request->op == HAL_AIO_READ ?
+            pread(request->file.fd, (char*)request->buffer + total, request->size - total, (off_t)(request->offset + total)) :
+            pwrite(request->file.fd, (const char*)request->buffer + total, request->size - total, (off_t)(request->offset + total));
+        if (moved < 0) {
+            if (errno == EINTR)
+                continue;
+            return total ? (int64_t)total : -(int64_t)errno;
+        }
+        if (!moved)
+            break;
+        total += (size_t)moved;
+    }
+    return (int64_t)total;
+}
+
+static int64_t aio_fsync(hal_aio_request_t *request) {
+    while (fsync(request->file.fd) != 0)
+        if (errno != EINTR)
+            return -(int64_t)errno;
+    return 0;
+}
+#endif
+
+/* Blocking fallback shared by the sync and thread backends */
+static void aio_execute(hal_aio_request_t *request) {
+    switch (request->op) {
+        case HAL_AIO_READ:
+        case HAL_AIO_WRITE:
+            request->result = aio_transfer(request);
+            break;
+        case HAL_AIO_FSYNC:
+            request->result = aio_fsync(request);
+            break;
+    }
+}
+
+#ifdef HAL_AIO_URING
+#define URING_OFFSET(BASE, OFF) ((unsigned*)((char*)(BASE) + (OFF)))
+
+static void uring_close(hal_aio_uring_t *ring) {
+    if (ring->sqes)
+        munmap(ring->sqes, ring->sqes_size);
+    if (ring->cq_map && ring->cq_map != ring->sq_map)
+        munmap(ring->cq_map, ring->cq_map_size);
+    if (ring->sq_map)
+        munmap(ring->sq_map, ring->sq_map_size);
+    if (ring->fd >= 0)
+        close(ring->fd);
+    memset(ring, 0, sizeof(hal_aio_uring_t));
+    ring->fd = -1;
+}
+
+static bool uring_open(hal_aio_uring_t *ring, unsigned int entries) {
+    struct io_uring_params params;
+    memset(ring, 0, sizeof(hal_aio_uring_t));
+    memset(&params, 0, sizeof(params));
+    /* Fails with ENOSYS on old kernels and EPERM under seccomp/sysctl lockdown */
+    if ((ring->fd = (int)syscall(__NR_io_uring_setup, entries, &params)) < 0) {
+        ring->fd = -1;
+        return false;
+    }
+
+    ring->sq_map_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_map_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    bool single = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single && ring->cq_map_size > ring->sq_map_size)
+        ring->sq_map_size = ring->cq_map_size;
+    ring->sq_map = mmap(NULL, ring->sq_map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    if (ring->sq_map == MAP_FAILED) {
+        ring->sq_map = NULL;
+        goto BAIL;
+    }
+    if (single)
+        ring->cq_map = ring->sq_map;
+    else if ((ring->cq_map = mmap(NULL, ring->cq_map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING)) == MAP_FAILED) {
+        ring->cq_map = NULL;
+        goto BAIL;
+    }
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = (struct io_uring_sqe*)mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED) {
+        ring->sqes = NULL;
+        goto BAIL;
+    }
+
+    ring->sq_head = URING_OFFSET(ring->sq_map, params.sq_off.head);
+    ring->sq_tail = URING_OFFSET(ring->sq_map, params.sq_off.tail);
+    ring->sq_mask = URING_OFFSET(ring->sq_map, params.sq_off.ring_mask);
+    ring->sq_array = URING_OFFSET(ring->sq_map, params.sq_off.array);
+    ring->sq_entries = params.sq_entries;
+    ring->cq_head = URING_OFFSET(ring->cq_map, params.cq_off.head);
+    ring->cq_tail = URING_OFFSET(ring->cq_map, params.cq_off.tail);
+    ring->cq_mask = URING_OFFSET(ring->cq_map, params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe*)((char*)ring->cq_map + params.cq_off.cqes);
+    ring->cq_entries = params.cq_entries;
+    return true;
+BAIL:
+    uring_close(ring);
+    return false;
+}
+
+static struct io_uring_sqe* uring_get_sqe(hal_aio_uring_t *ring) {
+    unsigned tail = *ring->sq_tail;
+    if (tail - __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE) >= ring->sq_entries)
+        return NULL;
+    /* Keep room in the completion ring for everything in flight */
+    if (ring->in_kernel + ring->unsubmitted >= ring->cq_entries)
+        return NULL;
+    unsigned index = tail & *ring->sq_mask;
+    struct io_uring_sqe *sqe = &ring->sqes[index];
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    ring->sq_array[index] = index;
+    return sqe;
+}
+
+static void uring_commit_sqe(hal_aio_uring_t *ring) {
+    __atomic_store_n(ring->sq_tail, *ring->sq_tail + 1, __ATOMIC_RELEASE);
+    ring->unsubmitted++;
+}
+
+static bool uring_enter(hal_aio_uring_t *ring, unsigned int wait_for) {
+    for (;;) {
+        unsigned flags = wait_for ? IORING_ENTER_GETEVENTS : 0;
+        long result = syscall(__NR_io_uring_enter, ring->fd, ring->unsubmitted, wait_for, flags, NULL, 0);
+        if (result >= 0) {
+            ring->unsubmitted -= (unsigned)result;
+            ring->in_kernel += (unsigned)result;
+            return true;
+        }
+        if (errno != EINTR)
+            return false;
+    }
+}
+
+static bool uring_queue(hal_aio_uring_t *ring, hal_aio_request_t *request) {
+    struct io_uring_sqe *sqe = uring_get_sqe(ring);
+    if (!sqe)
+        return false;
+    sqe->fd = request->file.fd;
+    sqe->user_data = (uint64_t)(uintptr_t)request;
+    switch (request->op) {
+        case HAL_AIO_READ:
+        case HAL_AIO_WRITE:
+            /* READV/WRITEV rather than READ/WRITE, they go back to the first io_uring kernels */
+            request->iov.iov_base = (char*)request->buffer + request->done;
+            request->iov.iov_len = request->size - request->done;
+            sqe->opcode = request->op == HAL_AIO_READ ? IORING_OP_READV : IORING_OP_WRITEV;
+            sqe->addr = (uint64_t)(uintptr_t)&request->iov;
+            sqe->len = 1;
+            sqe->off = request->offset + request->done;
+            break;
+        case HAL_AIO_FSYNC:
+            sqe->opcode = IORING_OP_FSYNC;
+            break;
+    }
+    uring_commit_sqe(ring);
+    return true;
+}
+
+static void uring_collect(hal_aio_t *aio) {
+    hal_aio_uring_t *ring = &aio->ring;
+    unsigned head = *ring->cq_head;
+    unsigned tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+    bool resubmit = false;
+    for (; head != tail; head++) {
+        struct io_uring_cqe *cqe = &ring->cqes[head & *ring->cq_mask];
+        hal_aio_request_t *request = (hal_aio_request_t*)(uintptr_t)cqe->user_data;
+        int32_t result = cqe->res;
+        ring->in_kernel--;
+        /* Timeouts from uring_wait carry no request */
+        if (!request)
+            continue;
+        if (request->op != HAL_AIO_FSYNC && result > 0 && request->done + (size_t)result < request->size) {
+            /* Short transfer, carry on from where it stopped like aio_transfer */
+            request->done += (size_t)result;
+            if (uring_queue(ring, request)) {
+                resubmit = true;
+                continue;
+            }
+            /* No room right now, hal_aio_submit picks it up first */
+            if (!(request->next = aio->queued.head))
+                aio->queued.tail = request;
+            aio->queued.head = request;
+            aio->running--;
+            continue;
+        }
+        /* Errors after a partial transfer report the partial count */
+        request->result = result < 0 && !request->done ? result : (int64_t)request->done + (result > 0 ? result : 0);
+        aio_list_push(&aio->ready, request);
+        aio->running--;
+    }
+    __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+    if (resubmit)
+        uring_enter(ring, 0);
+}
+
+static void uring_wait(hal_aio_t *aio, int timeout_ms) {
+    hal_aio_uring_t *ring = &aio->ring;
+    if (timeout_ms > 0) {
+        /* A timeout that also fires on the next completion bounds the wait */
+        struct io_uring_sqe *sqe = uring_get_sqe(ring);
+        if (!sqe) {
+            /* The rings are full of requests in flight, so don't block
+               without a bound, submit and let the caller reap what's done */
+            uring_enter(ring, 0);
+            return;
+        }
+        /* Kept in the ring, a failed enter leaves the SQE for the next one */
+        ring->timeout.tv_sec = timeout_ms / 1000;
+        ring->timeout.tv_nsec = (timeout_ms % 1000) * 1000000LL;
+        sqe->opcode = IORING_OP_TIMEOUT;
+        sqe->addr = (uint64_t)(uintptr_t)&ring->timeout;
+        sqe->len = 1;
+        sqe->off = 1;
+        sqe->user_data = 0;
+        uring_commit_sqe(ring);
+    }
+    uring_enter(ring, 1);
+}
+#endif
+
+#ifdef HAL_AIO_THREADS
+static void aio_task(void *userdata) {
+    hal_aio_request_t *request = (hal_aio_request_t*)userdata;
+    hal_aio_t *aio = request->owner;
+    aio_execute(request);
+    hal_mtx_lock(&aio->lock);
+    aio_list_push(&aio->done_list, request);
+    hal_cnd_signal(&aio->finished);
+    hal_mtx_unlock(&aio->lock);
+}
+
+static bool threads_start(hal_aio_t *aio, unsigned int count) {
+    aio->pool = count ? (aio->owned_pool = hal_pool_create(count)) : hal_pool_shared();
+    if (!aio->pool || !(aio->group = hal_pool_group_create(aio->pool))) {
+        hal_pool_destroy(aio->owned_pool);
+        aio->pool = aio->owned_pool = NULL;
+        return false;
+    }
+    hal_mtx_init(&aio->lock, HAL_MTX_PLAIN);
+    hal_cnd_init(&aio->finished);
+    return true;
+}
+
+static void threads_stop(hal_aio_t *aio) {
+    /* Runs whatever is still queued, the caller's buffers must outlive it */
+    hal_pool_group_destroy(aio->group);
+    hal_pool_destroy(aio->owned_pool);
+    hal_cnd_destroy(&aio->finished);
+    hal_mtx_destroy(&aio->lock);
+}
+
+static size_t threads_submit(hal_aio_t *aio) {
+    size_t count = 0;
+    hal_aio_request_t *request;
+    while ((request = aio_list_pop(&aio->queued)) != NULL) {
+        request->owner = aio;
+        if (hal_pool_submit(aio->pool, aio->group, aio_task, request))
+            aio->running++;
+        else {
+            /* No memory for a pool task, finish it here instead */
+            aio_execute(request);
+            aio_list_push(&aio->ready, request);
+        }
+        count++;
+    }
+    return count;
+}
+
+static void threads_collect(hal_aio_t *aio) {
+    hal_mtx_lock(&aio->lock);
+    for (hal_aio_request_t *request = aio->done_list.head; request; request = request->next)
+        aio->running--;
+    aio_list_append(&aio->ready, &aio->done_list);
+    hal_mtx_unlock(&aio->lock);
+}
+
+static void threads_wait(hal_aio_t *aio, int timeout_ms) {
+    hal_mtx_lock(&aio->lock);
+    if (timeout_ms < 0) {
+        while (!aio->done_list.head)
+            hal_cnd_wait(&aio->finished, &aio->lock);
+    } else if (!aio->done_list.head) {
+        hal_thrd_timeout deadline;
+        hal_timeout_after(&deadline, (uint64_t)timeout_ms * 1000000);
+        while (!aio->done_list.head)
+            if (hal_cnd_timedwait(&aio->finished, &aio->lock, &deadline) != HAL_THRD_SUCCESS)
+                break;
+    }
+    hal_mtx_unlock(&aio->lock);
+}
+#endif
+
+hal_aio_t* hal_aio_create(const hal_aio_options_t *options) {
+    hal_aio_t *aio = (hal_aio_t*)calloc(1, sizeof(hal_aio_t));
+    if (!aio)
+        return NULL;
+    aio->next_id = 1;
+    aio->backend = HAL_AIO_BACKEND_SYNC;
+    unsigned int depth = options && options->queue_depth ? options->queue_depth : HAL_AIO_DEFAULT_DEPTH;
+    unsigned int threads = options ? options->threads : 0;
+    (void)depth;
+    (void)threads;
+#ifdef HAL_AIO_URING
+    aio->ring.fd = -1;
+    if (!(options && options->no_uring) && uring_open(&aio->ring, depth)) {
+        aio->backend = HAL_AIO_BACKEND_IO_URING;
+        return aio;
+    }
+#endif
+#ifdef HAL_AIO_THREADS
+    if (threads_start(aio, threads))
+        aio->backend = HAL_AIO_BACKEND_THREADS;
+#endif
+    return aio;
+}
+
+hal_aio_backend_t hal_aio_backend(const hal_aio_t *aio) {
+    return aio ? aio->backend : HAL_AIO_BACKEND_SYNC;
+}
+
+size_t hal_aio_pending(const hal_aio_t *aio) {
+    return aio ? aio->pending : 0;
+}
+
+static uint64_t aio_queue(hal_aio_t *aio, hal_aio_op_t op, hal_file_t file, void *buffer, size_t size, uint64_t offset, hal_aio_callback callback, void *userdata) {
+    if (!aio || !hal_io_valid(file) || (op != HAL_AIO_FSYNC && !buffer))
+        return 0;
+    hal_aio_request_t *request = aio->free_list;
+    if (request)
+        aio->free_list = request->next;
+    else if (!(request = (hal_aio_request_t*)malloc(sizeof(hal_aio_request_t))))
+        return 0;
+    memset(request, 0, sizeof(hal_aio_request_t));
+    request->id = aio->next_id++;
+    request->op = op;
+    request->file = file;
+    request->buffer = buffer;
+    request->size = size;
+    request->offset = offset;
+    request->callback = callback;
+    request->userdata = userdata;
+    aio_list_push(&aio->queued, request);
+    aio->pending++;
+    return request->id;
+}
+
+uint64_t hal_aio_read(hal_aio_t *aio, hal_file_t file, void *buffer, size_t size, uint64_t offset, hal_aio_callback callback, void *userdata) {
+    return aio_queue(aio, HAL_AIO_READ, file, buffer, size, offset, callback, userdata);
+}
+
+uint64_t hal_aio_write(hal_aio_t *aio, hal_file_t file, const void *buffer, size_t size, uint64_t offset, hal_aio_callback callback, void *userdata) {
+    return aio_queue(aio, HAL_AIO_WRITE, file, (void*)buffer, size, offset, callback, userdata);
+}
+
+uint64_t hal_aio_fsync(hal_aio_t *aio, hal_file_t file, hal_aio_callback callback, void *userdata) {
+    return aio_queue(aio, HAL_AIO_FSYNC, file, NULL, 0, 0, callback, userdata);
+}
+
+size_t hal_aio_submit(hal_aio_t *aio) {
+    if (!aio || !aio->queued.head)
+        return 0;
+    size_t count = 0;
+    switch (aio->backend) {
+#ifdef HAL_AIO_URING
+        case HAL_AIO_BACKEND_IO_URING:
+            /* Whatever doesn't fit stays queued until completions make room */
+            while (aio->queued.head && uring_queue(&aio->ring, aio->queued.head)) {
+                aio_list_pop(&aio->queued);
+                count++;
+            }
+            /* SQEs the kernel didn't take yet are retried on the next enter */
+            uring_enter(&aio->ring, 0);
+            aio->running += count;
+            return count;
+#endif
+#ifdef HAL_AIO_THREADS
+        case HAL_AIO_BACKEND_THREADS:
+            return threads_submit(aio);
+#endif
+        default: {
+            hal_aio_request_t *request;
+            while ((request = aio_list_pop(&aio->queued)) != NULL) {
+                aio_execute(request);
+                aio_list_push(&aio->ready, request);
+                count++;
+            }
+            return count;
+        }
+    }
+}
+
+static void aio_collect(hal_aio_t *aio) {
+    switch (aio->backend) {
+#ifdef HAL_AIO_URING
+        case HAL_AIO_BACKEND_IO_URING:
+            uring_collect(aio);
+            break;
+#endif
+#ifdef HAL_AIO_THREADS
+        case HAL_AIO_BACKEND_THREADS:
+            threads_collect(aio);
+            break;
+#endif
+        default:
+            break;
+    }
+}
+
+static void aio_wait(hal_aio_t *aio, int timeout_ms) {
+    switch (aio->backend) {
+#ifdef HAL_AIO_URING
+        case HAL_AIO_BACKEND_IO_URING:
+            uring_wait(aio, timeout_ms);
+            break;
+#endif
+#ifdef HAL_AIO_THREADS
+        case HAL_AIO_BACKEND_THREADS:
+            threads_wait(aio, timeout_ms);
+            break;
+#endif
+        default:
+            (void)timeout_ms;
+            break;
+    }
+}
+
+/* Hand finished requests to their callbacks or the caller's array, returns false if none were delivered */
+static bool aio_deliver(hal_aio_t *aio, hal_aio_completion_t *completions, size_t max, size_t *written) {
+    bool delivered = false;
+    while (aio->ready.head) {
+        hal_aio_request_t *request = aio->ready.head;
+        if (!request->callback && (!completions || *written >= max))
+            break;
+        aio_list_pop(&aio->ready);
+        hal_aio_completion_t completion = {request->id, request->op, request->result, request->userdata};
+        hal_aio_callback callback = request->callback;
+        request->next = aio->free_list;
+        aio->free_list = request;
+        aio->pending--;
+        if (callback)
+            callback(&completion);
+        else
+            completions[(*written)++] = completion;
+        delivered = true;
+    }
+    return delivered;
+}
+
+size_t hal_aio_poll(hal_aio_t *aio, hal_aio_completion_t *completions, size_t max, int timeout_ms) {
+    if (!aio)
+        return 0;
+    size_t written = 0;
+    hal_aio_submit(aio);
+    aio_collect(aio);
+    if (aio_deliver(aio, completions, max, &written) || !timeout_ms || !aio->running)
+        return written;
+    aio_wait(aio, timeout_ms);
+    aio_collect(aio);
+    /* Completions may have freed room for requests that didn't fit before */
+    hal_aio_submit(aio);
+    aio_deliver(aio, completions, max, &written);
+    return written;
+}
+
+void hal_aio_destroy(hal_aio_t *aio) {
+    if (!aio)
+        return;
+    switch (aio->backend) {
+#ifdef HAL_AIO_URING
+        case HAL_AIO_BACKEND_IO_URING:
+            /* The kernel may still be writing into caller buffers */
+            while (aio->running) {
+                uring_enter(&aio->ring, 1);
+                uring_collect(aio);
+            }
+            uring_close(&aio->ring);
+            break;
+#endif
+#ifdef HAL_AIO_THREADS
+        case HAL_AIO_BACKEND_THREADS:
+            threads_stop(aio);
+            aio_list_append(&aio->ready, &aio->done_list);
+            break;
+#endif
+        default:
+            break;
+    }
+    aio_list_append(&aio->ready, &aio->queued);
+    hal_aio_request_t *request;
+    while ((request = aio_list_pop(&aio->ready)) != NULL)
+        free(request);
+    while ((request = aio->free_list) != NULL) {
+        aio->free_list = request->next;
+        free(request);
+    }
+    free(aio);
+}
+
+#endif /* HAL_NO_FILESYSTEM */
@@ -0,0 +1,209 @@
+/* https://github.com/takeiteasy/hal
+
+ hal Copyright (C) 2025 George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/* Buffered file streams - shared by all filesystem backends */
+
+#ifndef HAL_NO_FILESYSTEM
+#include "hal/filesystem.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define HAL_BUFIO_DEFAULT_CAPACITY (64 * 1024)
+
+/* hal_io_read/write report errors as 0 on Windows and (size_t)-1 on POSIX */
+static size_t bufio_raw_read(hal_bufio_t *io, void *buffer, size_t size) {
+    size_t result = hal_io_read(io->file, buffer, size);
+    if (result == 0 || result == (size_t)-1) {
+        io->eof = true;
+        return 0;
+    }
+    return result;
+}
+
+static bool bufio_raw_write(hal_bufio_t *io, const char *buffer, size_t size) {
+    while (size > 0) {
+        size_t result = hal_io_write(io->file, buffer, size);
+        if (result == 0 || result == (size_t)-1)
+            return false;
+        buffer += result;
+        size -= result;
+    }
+    return true;
+}
+
+bool hal_bufio_init(hal_bufio_t *dst, hal_file_t file, size_t capacity) {
+    if (!dst || !hal_io_valid(file))
+        return false;
+    memset(dst, 0, sizeof(hal_bufio_t));
+    dst->file = file;
+    dst->capacity = capacity ? capacity : HAL_BUFIO_DEFAULT_CAPACITY;
+    return (dst->buffer = (char*)malloc(dst->capacity)) != NULL;
+}
+
+bool hal_bufio_destroy(hal_bufio_t *io) {
+    if (!io)
+        return false;
+    bool result = hal_bufio_flush(io);
+    free(io->buffer);
+    io->buffer = NULL;
+    io->capacity = io->start = io->end = 0;
+    return result;
+}
+
+bool hal_bufio_flush(hal_bufio_t *io) {
+    if (!io || !io->buffer)
+        return false;
+    if (!io->writing)
+        return true;
+    bool result = bufio_raw_write(io, io->buffer, io->end);
+    io->end = 0;
+    return result;
+}
+
+/* Switch to reading, pending writes have to land first */
+static bool bufio_begin_read(hal_bufio_t *io) {
+    if (!io->writing)
+        return true;
+    if (!hal_bufio_flush(io))
+        return false;
+    io->writing = false;
+    io->start = io->end = 0;
+    return true;
+}
+
+/* Switch to writing, rewinding the file over read-ahead that was never consumed */
+static bool bufio_begin_write(hal_bufio_t *io) {
+    if (io->writing)
+        return true;
+    if (io->end > io->start && !hal_io_seek(io->file, -(long)(io->end - io->start), HAL_FILE_CURSOR))
+        return false;
+    io->writing = true;
+    io->eof = false;
+    io->start = io->end = 0;
+    return true;
+}
+
+/* Move unread bytes to the front and top the buffer up, returns bytes added */
+static size_t bufio_fill(hal_bufio_t *io) {
+    if (io->start > 0) {
+        memmove(io->buffer, io->buffer + io->start, io->end - io->start);
+        io->end -= io->start;
+        io->start = 0;
+    }
+    if (io->eof || io->end == io->capacity)
+        return 0;
+    size_t result = bufio_raw_read(io, io->buffer + io->end, io->capacity - io->end);
+    io->end += result;
+    return result;
+}
+
+size_t hal_bufio_read(hal_bufio_t *io, void *buffer, size_t size) {
+    if (!io || !io->buffer || !buffer || !bufio_begin_read(io))
+        return 0;
+    char *dst = (char*)buffer;
+    size_t total = 0;
+    while (total < size) {
+        size_t available = io->end - io->start;
+        if (available) {
+            size_t count = available < size - total ? available : size - total;
+            memcpy(dst + total, io->buffer + io->start, count);
+            io->start += count;
+            total += count;
+            continue;
+        }
+        if (io->eof)
+            break;
+        /* Big reads skip the buffer */
+        if (size - total >= io->capacity) {
+            size_t result = bufio_raw_read(io, dst + total, size - total);
+            if (!result)
+                break;
+            total += result;
+            continue;
+        }
+        io->start = io->end = 0;
+        if (!bufio_fill(io))
+            break;
+    }
+    return total;
+}
+
+bool hal_bufio_read_line(hal_bufio_t *io, const char **line, size_t *length) {
+    if (!io || !io->buffer || !line || !length || !bufio_begin_read(io))
+        return false;
+    size_t scanned = 0;
+    for (;;) {
+        /* memchr is vectorised by every libc we target */
+        char *start = io->buffer + io->start;
+        char *newline = (char*)memchr(start + scanned, '\n', io->end - io->start - scanned);
+        if (newline) {
+            size_t count = newline - start;
+            io->start += count + 1;
+            if (count && start[count - 1] == '\r')
+                count--;
+            *line = start;
+            *length = count;
+            return true;
+        }
+        scanned = io->end - io->start;
+
+        if (io->eof) {
+            if (!scanned)
+                return false;
+            /* Last line without a trailing newline */
+            io->start = io->end;
+            if (start[scanned - 1] == '\r')
+                scanned--;
+            *line = start;
+            *length = scanned;
+            return true;
+        }
+        if (io->start == 0 && io->end == io->capacity) {
+            char *buffer = (char*)realloc(io->buffer, io->capacity * 2);
+            if (!buffer)
+                return false;
+            io->buffer = buffer;
+            io->capacity *= 2;
+        }
+        bufio_fill(io);
+    }
+}
+
+size_t hal_bufio_write(hal_bufio_t *io, const void *buffer, size_t size) {
+    if (!io || !io->buffer || !buffer || !bufio_begin_write(io))
+        return 0;
+    const char *src = (const char*)buffer;
+    if (io->end + size > io->capacity) {
+        if (!hal_bufio_flush(io))
+            return 0;
+        /* Big writes skip the buffer */
+        if (size >= io->capacity)
+            return bufio_raw_write(io, src, size) ? size : 0;
+    }
+    memcpy(io->buffer + io->end, src, size);
+    io->end += size;
+    return size;
+}
+
+bool hal_bufio_write_string(hal_bufio_t *io, const char *str) {
+    if (!str)
+        return false;
+    size_t length = strlen(str);
+    return !length || hal_bufio_write(io, str, length) == length;
+}
+
+#endif /* HAL_NO_FILESYSTEM */
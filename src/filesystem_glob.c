@@ -0,0 +1,656 @@
+/* https://github.com/takeiteasy/hal
+
+ hal Copyright (C) 2025 George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/* Compiled glob patterns - shared by all filesystem backends */
+
+#ifndef HAL_NO_FILESYSTEM
+#include "hal/filesystem.h"
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define HAL_GLOB_MAX_ALTERNATIVES 256
+
+#if defined(_WIN32) || defined(_WIN64)
+#define GLOB_IS_SEPARATOR(C) ((C) == '\\' || (C) == '/')
+#define GLOB_FOLD(C) ((unsigned char)tolower((unsigned char)(C)))
+#define GLOB_ESCAPE(P) false
+#else
+#define GLOB_IS_SEPARATOR(C) ((C) == '/')
+#define GLOB_FOLD(C) ((unsigned char)(C))
+#define GLOB_ESCAPE(P) ((P)[0] == '\\' && (P)[1] != '\0')
+#endif
+
+typedef enum {
+    GLOB_TOKEN_CHAR,
+    GLOB_TOKEN_ANY,
+    GLOB_TOKEN_STAR,
+    GLOB_TOKEN_CLASS
+} glob_token_kind_t;
+
+typedef struct {
+    unsigned char kind;
+    unsigned char ch;
+    unsigned short cls;
+} glob_token_t;
+
+typedef enum {
+    GLOB_SEGMENT_LITERAL,
+    GLOB_SEGMENT_PATTERN,
+    GLOB_SEGMENT_GLOBSTAR,
+    GLOB_SEGMENT_ACCEPT
+} glob_segment_kind_t;
+
+typedef struct {
+    glob_segment_kind_t kind;
+    char *literal;
+    glob_token_t *tokens;
+    size_t num_tokens;
+} glob_segment_t;
+
+/* Every alternative is a run of segments followed by an accept state; the
+   pattern is matched as an NFA over those states, one path segment per step */
+struct hal_glob {
+    glob_segment_t *states;
+    size_t num_states;
+    size_t words;               /* uint64_t words per state set */
+    unsigned char (*classes)[32];
+    size_t num_classes;
+    char *root;                 /* Literal directory prefix shared by all alternatives, NULL for "." */
+    uint64_t *start;            /* States at the first segment */
+    uint64_t *rooted;           /* States after the root prefix */
+};
+
+typedef struct {
+    char **items;
+    size_t count;
+} glob_list_t;
+
+static bool glob_list_add(glob_list_t *list, char *item) {
+    if (!item)
+        return false;
+    if (list->count == HAL_GLOB_MAX_ALTERNATIVES) {
+        free(item);
+        return false;
+    }
+    char **items = (char**)realloc(list->items, (list->count + 1) * sizeof(char*));
+    if (!items) {
+        free(item);
+        return false;
+    }
+    items[list->count++] = item;
+    list->items = items;
+    return true;
+}
+
+static void glob_list_free(glob_list_t *list) {
+    for (size_t i = 0; i < list->count; i++)
+        free(list->items[i]);
+    free(list->items);
+}
+
+static const char* glob_skip_class(const char *p) {
+    /* p points at '[', returns the closing ']' or NULL if unterminated */
+    const char *q = p + 1;
+    if (*q == '!' || *q == '^')
+        q++;
+    if (*q == ']')
+        q++;
+    for (; *q; q++)
+        if (*q == ']')
+            return q;
+    return NULL;
+}
+
+/* Expand the first {a,b} group in pattern, recursing until no groups are left */
+static bool glob_expand(const char *pattern, size_t from, glob_list_t *out) {
+    for (const char *p = pattern + from; *p; p++) {
+        if (GLOB_ESCAPE(p)) {
+            p++;
+            continue;
+        }
+        if (*p == '[') {
+            const char *end = glob_skip_class(p);
+            if (end)
+                p = end;
+            continue;
+        }
+        if (*p != '{')
+            continue;
+
+        const char *commas[HAL_GLOB_MAX_ALTERNATIVES];
+        size_t num_commas = 0;
+        int depth = 0;
+        const char *q = p + 1, *close = NULL;
+        for (; *q && !close; q++) {
+            if (GLOB_ESCAPE(q))
+                q++;
+            else if (*q == '{')
+                depth++;
+            else if (*q == '}') {
+                if (depth-- == 0)
+                    close = q;
+            } else if (*q == ',' && depth == 0) {
+                if (num_commas == HAL_GLOB_MAX_ALTERNATIVES)
+                    return false;
+                commas[num_commas++] = q;
+            }
+        }
+        if (!close || !num_commas)
+            continue; /* Unmatched or single-item braces are literal */
+
+        size_t prefix = p - pattern;
+        size_t suffix = strlen(close + 1);
+        const char *start = p + 1;
+        for (size_t i = 0; i <= num_commas; i++) {
+            const char *end = i < num_commas ? commas[i] : close;
+            size_t length = end - start;
+            char *alternative = (char*)malloc(prefix + length + suffix + 1);
+            if (!alternative)
+                return false;
+            memcpy(alternative, pattern, prefix);
+            memcpy(alternative + prefix, start, length);
+            memcpy(alternative + prefix + length, close + 1, suffix + 1);
+            bool ok = glob_expand(alternative, prefix, out);
+            free(alternative);
+            if (!ok)
+                return false;
+            start = end + 1;
+        }
+        return true;
+    }
+    return glob_list_add(out, strdup(pattern));
+}
+
+static bool glob_compile_class(hal_glob_t *glob, const char *p, const char *end, glob_token_t *token) {
+    unsigned char (*classes)[32] = (unsigned char(*)[32])realloc(glob->classes, (glob->num_classes + 1) * 32);
+    if (!classes)
+        return false;
+    glob->classes = classes;
+    unsigned char *bits = classes[glob->num_classes];
+    memset(bits, 0, 32);
+
+    bool negate = *p == '!' || *p == '^';
+    if (negate)
+        p++;
+    for (const char *q = p; q < end; q++) {
+        unsigned char lo = GLOB_FOLD(*q), hi = lo;
+        if (q + 2 < end && q[1] == '-') {
+            hi = GLOB_FOLD(q[2]);
+            q += 2;
+        }
+        for (unsigned int c = lo; c <= hi; c++)
+            bits[c >> 3] |= 1 << (c & 7);
+    }
+    if (negate)
+        for (int i = 0; i < 32; i++)
+            bits[i] = ~bits[i];
+    token->kind = GLOB_TOKEN_CLASS;
+    token->cls = (unsigned short)glob->num_classes++;
+    return true;
+}
+
+static bool glob_compile_segment(hal_glob_t *glob, glob_segment_t *segment, const char *text, size_t length) {
+    if (length == 2 && text[0] == '*' && text[1] == '*') {
+        segment->kind = GLOB_SEGMENT_GLOBSTAR;
+        return true;
+    }
+
+    bool literal = true;
+    for (size_t i = 0; i < length && literal; i++)
+        if (text[i] == '*' || text[i] == '?' || text[i] == '[' || GLOB_ESCAPE(text + i))
+            literal = false;
+    if (literal) {
+        segment->kind = GLOB_SEGMENT_LITERAL;
+        if (!(segment->literal = (char*)malloc(length + 1)))
+            return false;
+        memcpy(segment->literal, text, length);
+        segment->literal[length] = '\0';
+        return true;
+    }
+
+    segment->kind = GLOB_SEGMENT_PATTERN;
+    if (!(segment->tokens = (glob_token_t*)malloc((length ? length : 1) * sizeof(glob_token_t))))
+        return false;
+    const char *end = text + length;
+    for (const char *p = text; p < end; p++) {
+        glob_token_t token = {GLOB_TOKEN_CHAR, 0, 0};
+        if (*p == '*') {
+            /* Runs of stars are one star */
+            if (segment->num_tokens && segment->tokens[segment->num_tokens - 1].kind == GLOB_TOKEN_STAR)
+                continue;
+            token.kind = GLOB_TOKEN_STAR;
+        } else if (*p == '?')
+            token.kind = GLOB_TOKEN_ANY;
+        else if (*p == '[' && glob_skip_class(p) && glob_skip_class(p) < end) {
+            const char *close = glob_skip_class(p);
+            if (!glob_compile_class(glob, p + 1, close, &token))
+                return false;
+            p = close;
+        } else {
+            if (GLOB_ESCAPE(p))
+                p++;
+            token.ch = GLOB_FOLD(*p);
+        }
+        segment->tokens[segment->num_tokens++] = token;
+    }
+    return true;
+}
+
+static bool glob_token_match(const hal_glob_t *glob, const glob_token_t *token, unsigned char c) {
+    switch (token->kind) {
+        case GLOB_TOKEN_ANY:
+            return true;
+        case GLOB_TOKEN_CLASS:
+            return glob->classes[token->cls][c >> 3] & (1 << (c & 7));
+        default:
+            return token->ch == c;
+    }
+}
+
+static bool glob_literal_match(const char *literal, const char *name, size_t length) {
+    size_t i = 0;
+    for (; i < length && literal[i]; i++)
+        if (GLOB_FOLD(literal[i]) != GLOB_FOLD(name[i]))
+            return false;
+    return i == length && !literal[i];
+}
+
+/* Greedy match with a single backtrack point, O(n*m) worst case */
+static bool glob_segment_match(const hal_glob_t *glob, const glob_segment_t *segment, const char *name, size_t length) {
+    if (segment->kind == GLOB_SEGMENT_GLOBSTAR)
+        return true;
+    if (segment->kind == GLOB_SEGMENT_LITERAL)
+        return glob_literal_match(segment->literal, name, length);
+    if (segment->kind != GLOB_SEGMENT_PATTERN || !length)
+        return false;
+
+    const glob_token_t *tokens = segment->tokens;
+    size_t n = segment->num_tokens, t = 0, s = 0;
+    size_t star_t = (size_t)-1, star_s = 0;
+    while (s < length) {
+        unsigned char c = GLOB_FOLD(name[s]);
+        if (t < n && tokens[t].kind == GLOB_TOKEN_STAR) {
+            star_t = ++t;
+            star_s = s;
+        } else if (t < n && glob_token_match(glob, &tokens[t], c)) {
+            t++;
+            s++;
+        } else if (star_t != (size_t)-1) {
+            t = star_t;
+            s = ++star_s;
+        } else
+            return false;
+    }
+    while (t < n && tokens[t].kind == GLOB_TOKEN_STAR)
+        t++;
+    return t == n;
+}
+
+#define GLOB_TEST(SET, I) ((SET)[(I) >> 6] & (1ULL << ((I) & 63)))
+#define GLOB_SET(SET, I) ((SET)[(I) >> 6] |= (1ULL << ((I) & 63)))
+
+/* ** may match zero segments, so it also activates the state after it */
+static void glob_closure(const hal_glob_t *glob, uint64_t *set) {
+    for (size_t i = 0; i < glob->num_states; i++)
+        if (GLOB_TEST(set, i) && glob->states[i].kind == GLOB_SEGMENT_GLOBSTAR)
+            GLOB_SET(set, i + 1);
+}
+
+static void glob_step(const hal_glob_t *glob, const uint64_t *from, uint64_t *to, const char *name, size_t length) {
+    memset(to, 0, glob->words * sizeof(uint64_t));
+    for (size_t i = 0; i < glob->num_states; i++) {
+        if (!GLOB_TEST(from, i))
+            continue;
+        const glob_segment_t *segment = &glob->states[i];
+        if (segment->kind == GLOB_SEGMENT_GLOBSTAR)
+            GLOB_SET(to, i);
+        else if (glob_segment_match(glob, segment, name, length))
+            GLOB_SET(to, i + 1);
+    }
+    glob_closure(glob, to);
+}
+
+static bool glob_accepts(const hal_glob_t *glob, const uint64_t *set) {
+    for (size_t i = 0; i < glob->num_states; i++)
+        if (GLOB_TEST(set, i) && glob->states[i].kind == GLOB_SEGMENT_ACCEPT)
+            return true;
+    return false;
+}
+
+/* True while more segments could still match below this directory */
+static bool glob_continues(const hal_glob_t *glob, const uint64_t *set) {
+    for (size_t i = 0; i < glob->num_states; i++)
+        if (GLOB_TEST(set, i) && glob->states[i].kind != GLOB_SEGMENT_ACCEPT)
+            return true;
+    return false;
+}
+
+void hal_glob_free(hal_glob_t *glob) {
+    if (!glob)
+        return;
+    for (size_t i = 0; i < glob->num_states; i++) {
+        free(glob->states[i].literal);
+        free(glob->states[i].tokens);
+    }
+    free(glob->states);
+    free(glob->classes);
+    free(glob->root);
+    free(glob->start);
+    free(glob->rooted);
+    free(glob);
+}
+
+typedef struct {
+    const char *text;
+    size_t length;
+} glob_span_t;
+
+static size_t glob_split(const char *pattern, glob_span_t *spans, size_t max) {
+    size_t count = 0;
+    const char *p = pattern;
+    if (GLOB_IS_SEPARATOR(*p)) {
+        /* Absolute patterns start with an empty segment */
+        if (count < max)
+            spans[count] = (glob_span_t){p, 0};
+        count++;
+        while (GLOB_IS_SEPARATOR(*p))
+            p++;
+    }
+    while (*p) {
+        const char *start = p;
+        while (*p && !GLOB_IS_SEPARATOR(*p)) {
+            if (*p == '[' && glob_skip_class(p)) {
+                const char *close = glob_skip_class(p);
+                const char *q = p;
+                while (q < close && !GLOB_IS_SEPARATOR(*q))
+                    q++;
+                if (q == close) {
+                    p = close + 1;
+                    continue;
+                }
+            }
+            p += GLOB_ESCAPE(p) ? 2 : 1;
+        }
+        if (count < max)
+            spans[count] = (glob_span_t){start, (size_t)(p - start)};
+        count++;
+        while (GLOB_IS_SEPARATOR(*p))
+            p++;
+    }
+    return count;
+}
+
+hal_glob_t* hal_glob_compile(const char *pattern) {
+    if (!pattern || !*pattern)
+        return NULL;
+    glob_list_t alternatives = {NULL, 0};
+    hal_glob_t *glob = (hal_glob_t*)calloc(1, sizeof(hal_glob_t));
+    glob_span_t *spans = NULL;
+    size_t *bases = NULL, root_segments = (size_t)-1;
+    if (!glob || !glob_expand(pattern, 0, &alternatives))
+        goto BAIL;
+
+    size_t total = 0, max_spans = 0;
+    for (size_t i = 0; i < alternatives.count; i++) {
+        size_t count = glob_split(alternatives.items[i], NULL, 0);
+        if (!count)
+            goto BAIL;
+        total += count + 1;
+        if (count > max_spans)
+            max_spans = count;
+    }
+    if (!(glob->states = (glob_segment_t*)calloc(total, sizeof(glob_segment_t))) ||
+        !(spans = (glob_span_t*)malloc(max_spans * sizeof(glob_span_t))) ||
+        !(bases = (size_t*)malloc(alternatives.count * sizeof(size_t))))
+        goto BAIL;
+    glob->num_states = total;
+    glob->words = (total + 63) / 64;
+
+    size_t state = 0;
+    const char *first = alternatives.items[0];
+    size_t first_count = glob_split(first, spans, max_spans);
+    glob_span_t *first_spans = (glob_span_t*)malloc(first_count * sizeof(glob_span_t));
+    if (!first_spans)
+        goto BAIL;
+    memcpy(first_spans, spans, first_count * sizeof(glob_span_t));
+
+    for (size_t i = 0; i < alternatives.count; i++) {
+        size_t count = glob_split(alternatives.items[i], spans, max_spans);
+        bases[i] = state;
+        for (size_t j = 0; j < count; j++)
+            if (!glob_compile_segment(glob, &glob->states[state++], spans[j].text, spans[j].length)) {
+                free(first_spans);
+                goto BAIL;
+            }
+        glob->states[state++].kind = GLOB_SEGMENT_ACCEPT;
+
+        /* Directory prefix that every alternative spells out literally */
+        size_t shared = 0;
+        while (shared + 1 < count && shared + 1 < first_count &&
+               spans[shared].length == first_spans[shared].length &&
+               !memcmp(spans[shared].text, first_spans[shared].text, spans[shared].length) &&
+               glob->states[bases[i] + shared].kind == GLOB_SEGMENT_LITERAL)
+            shared++;
+        if (shared < root_segments)
+            root_segments = shared;
+    }
+
+    if (root_segments > 0) {
+        size_t length = 0;
+        for (size_t j = 0; j < root_segments; j++)
+            length += first_spans[j].length + 1;
+        if (!(glob->root = (char*)malloc(length + 2))) {
+            free(first_spans);
+            goto BAIL;
+        }
+        char *p = glob->root;
+        for (size_t j = 0; j < root_segments; j++) {
+            memcpy(p, first_spans[j].text, first_spans[j].length);
+            p += first_spans[j].length;
+            *p++ = HAL_PATH_SEPARATOR;
+        }
+        /* Keep the separator for "/" and "C:\", drop it otherwise */
+        if (p - glob->root > 1 && p[-2] != ':')
+            p--;
+        *p = '\0';
+    }
+    free(first_spans);
+
+    if (!(glob->start = (uint64_t*)calloc(glob->words, sizeof(uint64_t))) ||
+        !(glob->rooted = (uint64_t*)calloc(glob->words, sizeof(uint64_t))))
+        goto BAIL;
+    for (size_t i = 0; i < alternatives.count; i++) {
+        GLOB_SET(glob->start, bases[i]);
+        GLOB_SET(glob->rooted, bases[i] + root_segments);
+    }
+    glob_closure(glob, glob->start);
+    glob_closure(glob, glob->rooted);
+
+    glob_list_free(&alternatives);
+    free(spans);
+    free(bases);
+    return glob;
+BAIL:
+    glob_list_free(&alternatives);
+    free(spans);
+    free(bases);
+    hal_glob_free(glob);
+    return NULL;
+}
+
+bool hal_glob_match(const hal_glob_t *glob, const char *path) {
+    if (!glob || !path)
+        return false;
+    uint64_t *sets = (uint64_t*)malloc(glob->words * 2 * sizeof(uint64_t));
+    if (!sets)
+        return false;
+    uint64_t *current = sets, *next = sets + glob->words;
+    memcpy(current, glob->start, glob->words * sizeof(uint64_t));
+
+    const char *p = path;
+    if (GLOB_IS_SEPARATOR(*p)) {
+        glob_step(glob, current, next, "", 0);
+        uint64_t *swap = current; current = next; next = swap;
+        while (GLOB_IS_SEPARATOR(*p))
+            p++;
+    }
+    while (*p) {
+        const char *start = p;
+        while (*p && !GLOB_IS_SEPARATOR(*p))
+            p++;
+        glob_step(glob, current, next, start, p - start);
+        uint64_t *swap = current; current = next; next = swap;
+        while (GLOB_IS_SEPARATOR(*p))
+            p++;
+    }
+    bool result = glob_accepts(glob, current);
+    free(sets);
+    return result;
+}
+
+/* Glob traversal, holds one state set per depth plus the walker's path buffer */
+typedef struct {
+    const hal_glob_t *glob;
+    uint64_t *sets;             /* One state set per depth, grown as the walk descends */
+    size_t depth_capacity;
+    hal_glob_callback callback; /* Streams matches when set, otherwise they are collected */
+    void *userdata;
+    char **matches;
+    size_t count, capacity;
+    bool stopped;
+    bool failed;
+} glob_walk_t;
+
+static uint64_t* glob_walk_level(glob_walk_t *walk, size_t depth) {
+    if (depth >= walk->depth_capacity) {
+        size_t capacity = walk->depth_capacity ? walk->depth_capacity * 2 : 16;
+        while (capacity <= depth)
+            capacity *= 2;
+        uint64_t *sets = (uint64_t*)realloc(walk->sets, capacity * walk->glob->words * sizeof(uint64_t));
+        if (!sets)
+            return NULL;
+        walk->sets = sets;
+        walk->depth_capacity = capacity;
+    }
+    return walk->sets + depth * walk->glob->words;
+}
+
+static bool glob_emit(glob_walk_t *walk, hal_walk_entry_t *entry) {
+    if (walk->callback) {
+        if (walk->callback(hal_walk_entry_dir(entry), entry->name, walk->userdata) != 0) {
+            walk->stopped = true;
+            return false;
+        }
+        return true;
+    }
+
+    if (walk->count == walk->capacity) {
+        size_t capacity = walk->capacity ? walk->capacity * 2 : 8;
+        char **matches = (char**)realloc(walk->matches, capacity * sizeof(char*));
+        if (!matches)
+            goto FAIL;
+        walk->matches = matches;
+        walk->capacity = capacity;
+    }
+    const char *path = hal_walk_entry_path(entry);
+    if (!path || !(walk->matches[walk->count] = strdup(path)))
+        goto FAIL;
+    walk->count++;
+    return true;
+FAIL:
+    walk->failed = true;
+    return false;
+}
+
+/* Only regular files match, symbolic links count when they point at one */
+static bool glob_is_file(hal_walk_entry_t *entry) {
+    if (entry->type == HAL_PATH_FILE)
+        return true;
+    if (entry->type != HAL_PATH_SYMLINK)
+        return false;
+    hal_path_stat_t st;
+    const char *path = hal_walk_entry_path(entry);
+    return path && hal_path_stat(path, &st, true) && st.type == HAL_PATH_FILE;
+}
+
+static int glob_visit(hal_walk_entry_t *entry, void *userdata) {
+    glob_walk_t *walk = (glob_walk_t*)userdata;
+    const hal_glob_t *glob = walk->glob;
+    uint64_t *next = glob_walk_level(walk, entry->depth + 1);
+    if (!next) {
+        walk->failed = true;
+        return HAL_WALK_STOP;
+    }
+    uint64_t *current = walk->sets + entry->depth * glob->words;
+    glob_step(glob, current, next, entry->name, strlen(entry->name));
+
+    if (entry->type == HAL_PATH_DIRECTORY)
+        return glob_continues(glob, next) ? HAL_WALK_CONTINUE : HAL_WALK_SKIP;
+    if (glob_accepts(glob, next) && glob_is_file(entry) && !glob_emit(walk, entry))
+        return HAL_WALK_STOP;
+    return HAL_WALK_CONTINUE;
+}
+
+static bool glob_run(const char *pattern, glob_walk_t *walk) {
+    hal_glob_t *glob = hal_glob_compile(pattern);
+    if (!glob)
+        return false;
+    walk->glob = glob;
+    uint64_t *start = glob_walk_level(walk, 0);
+    if (start) {
+        memcpy(start, glob->rooted, glob->words * sizeof(uint64_t));
+        /* A missing root just means nothing matched */
+        hal_path_walk_ex(glob->root ? glob->root : ".", HAL_WALK_RECURSIVE | HAL_WALK_DIRECTORIES, glob_visit, walk);
+    } else
+        walk->failed = true;
+    free(walk->sets);
+    walk->sets = NULL;
+    hal_glob_free(glob);
+    return !walk->failed && !walk->stopped;
+}
+
+const char** hal_directory_glob(const char *pattern, int *count) {
+    if (count)
+        *count = 0;
+    glob_walk_t walk;
+    memset(&walk, 0, sizeof(walk));
+    if (!glob_run(pattern, &walk) || !walk.count) {
+        for (size_t i = 0; i < walk.count; i++)
+            free(walk.matches[i]);
+        free(walk.matches);
+        return NULL;
+    }
+    if (count)
+        *count = (int)walk.count;
+    return (const char**)walk.matches;
+}
+
+bool hal_path_glob(const char *pattern, hal_glob_callback callback, void *userdata) {
+    if (!pattern || !callback)
+        return false;
+    /* Nothing can match an empty pattern */
+    if (!*pattern)
+        return true;
+    glob_walk_t walk;
+    memset(&walk, 0, sizeof(walk));
+    walk.callback = callback;
+    walk.userdata = userdata;
+    return glob_run(pattern, &walk);
+}
+
+#endif /* HAL_NO_FILESYSTEM */
@@ -2,18 +2,43 @@
    POSIX filesystem implementation */
 
 #ifndef HAL_NO_FILESYSTEM
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* fallocate */
+#endif
+#ifndef HAL_NO_THREADS
+#define HAL_FILESYSTEM_PARALLEL
+#endif
 #include "hal/filesystem.h"
+#ifdef HAL_FILESYSTEM_PARALLEL
+#include "hal/threads.h"
+#endif
 
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #include <fcntl.h>
+#if defined(__linux__)
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#include <sys/syscall.h>
+#include <linux/fs.h>
+#ifndef FICLONE
+#define FICLONE _IOW(0x94, 9, int)
+#endif
+#ifndef RENAME_NOREPLACE
+#define RENAME_NOREPLACE (1 << 0)
+#endif
+#endif
 #include <dirent.h>
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
 #include <stdio.h>
 #include <stdarg.h>
+#include <stddef.h>
+#include <limits.h>
 
 /* Constants */
 const hal_file_t hal_io_invalid = {.fd=HAL_INVALID_FILE_HANDLE};
@@ -100,6 +125,42 @@ bool hal_io_flush(hal_file_t file) {
     return fsync(file.fd) == 0;
 }
 
+/* Apple's headers don't declare fdatasync */
+static int sync_data(int fd) {
+#if defined(__APPLE__)
+    return fsync(fd);
+#else
+    return fdatasync(fd);
+#endif
+}
+
+bool hal_io_sync(hal_file_t file, hal_io_sync_t mode, uint64_t offset, uint64_t length) {
+    if (!hal_io_valid(file))
+        return false;
+    switch (mode) {
+        case HAL_SYNC_NONE:
+            return true;
+        case HAL_SYNC_DATA:
+            return sync_data(file.fd) == 0;
+        case HAL_SYNC_FULL:
+            return fsync(file.fd) == 0;
+        case HAL_SYNC_RANGE:
+#if defined(__linux__) && !defined(__ANDROID__)
+            if (sync_file_range(file.fd, (off_t)offset, (off_t)length,
+                                SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER) == 0)
+                return true;
+            if (errno != ENOSYS && errno != EINVAL)
+                return false;
+#else
+            (void)offset;
+            (void)length;
+#endif
+            return sync_data(file.fd) == 0;
+        default:
+            return false;
+    }
+}
+
 bool hal_io_valid(hal_file_t file) {
     return file.fd >= 0;
 }
@@ -136,6 +197,100 @@ bool hal_io_truncate(hal_file_t file, long size) {
     return ftruncate(file.fd, size) == 0;
 }
 
+size_t hal_io_pread(hal_file_t file, void *buffer, size_t size, uint64_t offset) {
+    if (!hal_io_valid(file) || !buffer)
+        return 0;
+    size_t total = 0;
+    while (total < size) {
+        ssize_t result = pread(file.fd, (char*)buffer + total, size - total, (off_t)(offset + total));
+        if (result < 0 && errno == EINTR)
+            continue;
+        if (result <= 0)
+            break;
+        total += (size_t)result;
+    }
+    return total;
+}
+
+size_t hal_io_pwrite(hal_file_t file, const void *buffer, size_t size, uint64_t offset) {
+    if (!hal_io_valid(file) || !buffer)
+        return 0;
+    size_t total = 0;
+    while (total < size) {
+        ssize_t result = pwrite(file.fd, (const char*)buffer + total, size - total, (off_t)(offset + total));
+        if (result < 0 && errno == EINTR)
+            continue;
+        if (result <= 0)
+            break;
+        total += (size_t)result;
+    }
+    return total;
+}
+
+_Static_assert(sizeof(hal_io_vec_t) == sizeof(struct iovec) &&
+               offsetof(hal_io_vec_t, data) == offsetof(struct iovec, iov_base) &&
+               offsetof(hal_io_vec_t, size) == offsetof(struct iovec, iov_len),
+               "hal_io_vec_t must match struct iovec");
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+size_t hal_io_readv(hal_file_t file, const hal_io_vec_t *vecs, size_t count) {
+    if (!hal_io_valid(file) || !vecs)
+        return 0;
+    size_t total = 0;
+    while (count > 0) {
+        int batch = count > IOV_MAX ? IOV_MAX : (int)count;
+        ssize_t result = readv(file.fd, (const struct iovec*)vecs, batch);
+        if (result < 0 && errno == EINTR)
+            continue;
+        if (result <= 0)
+            break;
+        total += (size_t)result;
+        /* Stop on a short read, the caller can't tell which buffer it ended in otherwise */
+        size_t expected = 0;
+        for (int i = 0; i < batch; i++)
+            expected += vecs[i].size;
+        if ((size_t)result < expected)
+            break;
+        vecs += batch;
+        count -= batch;
+    }
+    return total;
+}
+
+size_t hal_io_writev(hal_file_t file, const hal_io_vec_t *vecs, size_t count) {
+    if (!hal_io_valid(file) || !vecs)
+        return 0;
+    size_t total = 0;
+    while (count > 0) {
+        int batch = count > IOV_MAX ? IOV_MAX : (int)count;
+        ssize_t result = writev(file.fd, (const struct iovec*)vecs, batch);
+        if (result < 0 && errno == EINTR)
+            continue;
+        if (result <= 0)
+            break;
+        total += (size_t)result;
+        /* Finish a partially written buffer with plain writes before moving on */
+        size_t done = (size_t)result;
+        while (count > 0 && done >= vecs->size) {
+            done -= vecs->size;
+            vecs++;
+            count--;
+        }
+        if (count > 0 && done > 0) {
+            size_t rest = vecs->size - done;
+            if (hal_io_write(file, (const char*)vecs->data + done, rest) != rest)
+                break;
+            total += rest;
+            vecs++;
+            count--;
+        }
+    }
+    return total;
+}
+
 /* hal_file_* functions */
 bool hal_file_exists(const char *path) {
     if (!path)
@@ -152,12 +307,43 @@ bool hal_file_delete(const char *path) {
     return unlink(path) == 0;
 }
 
+/* rename(2) that fails with EEXIST instead of replacing new_path */
+static int rename_noreplace(const char *old_path, const char *new_path, bool is_dir) {
+#if defined(__linux__) && defined(SYS_renameat2)
+    if (syscall(SYS_renameat2, AT_FDCWD, old_path, AT_FDCWD, new_path, RENAME_NOREPLACE) == 0)
+        return 0;
+    /* ENOSYS before 3.15, EINVAL from filesystems without RENAME_NOREPLACE */
+    if (errno != ENOSYS && errno != EINVAL)
+        return -1;
+#elif defined(__APPLE__) && defined(RENAME_EXCL)
+    if (renamex_np(old_path, new_path, RENAME_EXCL) == 0)
+        return 0;
+    if (errno != ENOTSUP)
+        return -1;
+#endif
+    /* link() refuses to replace, so files stay atomic without kernel support */
+    if (!is_dir) {
+        if (link(old_path, new_path) == 0)
+            return unlink(old_path);
+        if (errno != EPERM && errno != ENOTSUP && errno != EOPNOTSUPP)
+            return -1;
+    }
+    /* Last resort: check then rename, racy against other writers */
+    struct stat st;
+    if (lstat(new_path, &st) == 0) {
+        errno = EEXIST;
+        return -1;
+    }
+    return rename(old_path, new_path);
+}
+
 bool hal_file_rename(const char *old_path, const char *new_path, bool write_over) {
-    if (!old_path || !hal_file_exists(old_path) || !new_path || (!write_over && hal_file_exists(new_path)))
+    if (!old_path || !new_path || !hal_file_exists(old_path))
         return false;
-    if (link(old_path, new_path) == 0)
-        return unlink(old_path) == 0;
-    return false;
+    if ((write_over ? rename(old_path, new_path) : rename_noreplace(old_path, new_path, false)) == 0)
+        return true;
+    /* Different filesystems, the data has to move */
+    return errno == EXDEV && hal_file_copy(old_path, new_path, write_over) && unlink(old_path) == 0;
 }
 
 int hal_file_size(const char *path) {
@@ -169,33 +355,162 @@ int hal_file_size(const char *path) {
     return (int)st.st_size;
 }
 
-bool hal_file_copy(const char *src_path, const char *dst_path, bool write_over) {
-    if (!src_path || !dst_path || !hal_file_exists(src_path) || (hal_path_exists(dst_path) && !write_over))
+#define HAL_COPY_BUFFER_SIZE (1 << 20)
+#define HAL_COPY_BUFFER_ALIGN 4096
+
+/* Copy from *offset to end of file, advancing *offset */
+static bool copy_buffered(int src, int dst, off_t *offset) {
+    void *buffer = NULL;
+    bool result = true;
+    if (posix_memalign(&buffer, HAL_COPY_BUFFER_ALIGN, HAL_COPY_BUFFER_SIZE) != 0)
         return false;
+    for (;;) {
+        ssize_t bytes_read = pread(src, buffer, HAL_COPY_BUFFER_SIZE, *offset);
+        if (bytes_read < 0) {
+            if (errno == EINTR)
+                continue;
+            result = false;
+            break;
+        }
+        if (bytes_read == 0)
+            break;
+        for (ssize_t done = 0; done < bytes_read;) {
+            ssize_t bytes_written = pwrite(dst, (char*)buffer + done, bytes_read - done, *offset + done);
+            if (bytes_written < 0) {
+                if (errno == EINTR)
+                    continue;
+                result = false;
+                goto BAIL;
+            }
+            done += bytes_written;
+        }
+        *offset += bytes_read;
+    }
+BAIL:
+    free(buffer);
+    return result;
+}
+
+#if defined(__linux__)
+/* Kernel offload helpers return 1 when done, 0 to fall back to the next strategy, -1 on error */
+static int offload_unsupported(int error) {
+    return error == ENOSYS || error == EXDEV || error == EINVAL || error == EOPNOTSUPP ||
+        error == ENOTSUP || error == EBADF || error == EPERM;
+}
+
+static int copy_range(int src, int dst, off_t size, off_t *offset) {
+#ifdef __NR_copy_file_range
+    while (*offset < size) {
+        loff_t in = *offset, out = *offset;
+        ssize_t copied = syscall(__NR_copy_file_range, src, &in, dst, &out, (size_t)(size - *offset), 0);
+        if (copied < 0) {
+            if (errno == EINTR)
+                continue;
+            return offload_unsupported(errno) ? 0 : -1;
+        }
+        if (copied == 0)
+            break;
+        *offset += copied;
+    }
+    return 1;
+#else
+    (void)src, (void)dst, (void)size, (void)offset;
+    return 0;
+#endif
+}
+
+static int copy_sendfile(int src, int dst, off_t size, off_t *offset) {
+    if (lseek(dst, *offset, SEEK_SET) == -1)
+        return 0;
+    while (*offset < size) {
+        off_t in = *offset;
+        ssize_t copied = sendfile(dst, src, &in, (size_t)(size - *offset));
+        if (copied < 0) {
+            if (errno == EINTR)
+                continue;
+            return offload_unsupported(errno) ? 0 : -1;
+        }
+        if (copied == 0)
+            break;
+        *offset += copied;
+    }
+    return 1;
+}
+#endif
+
+bool hal_file_copy(const char *src_path, const char *dst_path, bool write_over) {
+    return hal_file_copy_ex(src_path, dst_path, write_over, NULL);
+}
 
-    static const size_t buffer_size = 4096;
-    hal_file_t src_fd = {-1}, dst_fd = {-1};
-    ssize_t bytes_read, bytes_written;
-    char buffer[4096];
+bool hal_file_copy_ex(const char *src_path, const char *dst_path, bool write_over, hal_file_copy_method_t *method) {
+    hal_file_copy_method_t used = HAL_FILE_COPY_NONE;
+    struct stat src_st, dst_st;
+    int src = -1, dst = -1;
+    off_t offset = 0;
     bool result = false;
 
-    if (!hal_io_open(&src_fd, src_path, HAL_FILE_READ))
+    if (method)
+        *method = HAL_FILE_COPY_NONE;
+    if (!src_path || !dst_path)
+        return false;
+    if (stat(dst_path, &dst_st) == 0) {
+        if (!write_over)
+            return false;
+        if (stat(src_path, &src_st) == 0 && src_st.st_dev == dst_st.st_dev && src_st.st_ino == dst_st.st_ino)
+            return false;
+    }
+
+    if ((src = open(src_path, O_RDONLY | O_CLOEXEC)) == -1)
+        goto BAIL;
+    if (fstat(src, &src_st) == -1 || !S_ISREG(src_st.st_mode))
         goto BAIL;
-    if (!hal_io_open(&dst_fd, dst_path, HAL_FILE_WRITE))
+    if ((dst = open(dst_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC | (write_over ? 0 : O_EXCL), src_st.st_mode & 0777)) == -1)
         goto BAIL;
+    /* open() applies the umask and leaves existing files' modes alone */
+    fchmod(dst, src_st.st_mode & 07777);
+
+#if defined(__linux__)
+    /* Files such as procfs entries report size 0 but have contents, copy those by reading */
+    if (src_st.st_size > 0) {
+        if (ioctl(dst, FICLONE, src) == 0) {
+            used = HAL_FILE_COPY_CLONE;
+            result = true;
+            goto BAIL;
+        }
 
-    while ((bytes_read = hal_io_read(src_fd, buffer, buffer_size)) > 0)
-        if ((bytes_written = hal_io_write(dst_fd, buffer, bytes_read)) != bytes_read)
+        /* Preallocate so the copy is laid out contiguously; unsupported filesystems just skip it */
+        fallocate(dst, 0, 0, src_st.st_size);
+
+        int status = copy_range(src, dst, src_st.st_size, &offset);
+        if (status > 0)
+            used = HAL_FILE_COPY_RANGE;
+        else if (status == 0 && (status = copy_sendfile(src, dst, src_st.st_size, &offset)) > 0)
+            used = HAL_FILE_COPY_SENDFILE;
+        if (status < 0)
             goto BAIL;
-    if (bytes_read == -1)
-        goto BAIL;
-    result = true;
+        if (status > 0 && offset >= src_st.st_size) {
+            result = true;
+            goto BAIL;
+        }
+        /* A short offloaded copy isn't proof the source shrank, finish the
+           tail by reading, which only stops at the real end of file */
+    }
+#endif
+
+    if (copy_buffered(src, dst, &offset)) {
+        if (used == HAL_FILE_COPY_NONE)
+            used = HAL_FILE_COPY_BUFFERED;
+        /* Drop any preallocated tail if the source shrank */
+        result = offset >= src_st.st_size || ftruncate(dst, offset) == 0;
+    }
 
 BAIL:
-    if (hal_io_valid(src_fd))
-        hal_io_close(&src_fd);
-    if (hal_io_valid(dst_fd))
-        hal_io_close(&dst_fd);
+    if (src != -1)
+        close(src);
+    if (dst != -1)
+        close(dst);
+    if (result && method)
+        *method = used;
     return result;
 }
 
@@ -203,18 +518,22 @@ const char* hal_file_read(const char *path, size_t *size) {
     char *result = NULL;
     long _size = -1;
     hal_file_t file = hal_io_invalid;
-    if (!path || !hal_file_exists(path) || !hal_io_open(&file, path, HAL_FILE_READ))
+    struct stat st;
+    if (!path || !hal_io_open(&file, path, HAL_FILE_READ))
         goto BAIL;
-    hal_io_seek(file, 0, HAL_FILE_START);
-    hal_io_seek(file, 0, HAL_FILE_FINISH);
-    if ((_size = hal_io_tell(file)) == -1)
+    if (fstat(file.fd, &st) == -1 || !S_ISREG(st.st_mode))
         goto BAIL;
-    hal_io_seek(file, 0, HAL_FILE_START);
+    _size = (long)st.st_size;
     if (!(result = (char*)malloc(_size * sizeof(char))))
         goto BAIL;
-    if (!hal_io_read(file, result, _size)) {
-        free(result);
-        goto BAIL;
+    for (long done = 0; done < _size;) {
+        ssize_t bytes_read = read(file.fd, result + done, _size - done);
+        if (bytes_read <= 0) {
+            free(result);
+            result = NULL;
+            goto BAIL;
+        }
+        done += bytes_read;
     }
 BAIL:
     if (hal_io_valid(file))
@@ -224,6 +543,103 @@ BAIL:
     return result;
 }
 
+/* fsync the directory holding path so a rename into it survives a crash */
+static bool sync_parent_directory(const char *path) {
+    char dir[HAL_MAX_PATH];
+    const char *slash = strrchr(path, '/');
+    if (!slash)
+        strcpy(dir, ".");
+    else {
+        size_t length = slash == path ? 1 : (size_t)(slash - path);
+        if (length >= sizeof(dir))
+            return false;
+        memcpy(dir, path, length);
+        dir[length] = '\0';
+    }
+    int fd = open(dir, O_RDONLY | O_DIRECTORY);
+    if (fd == -1)
+        return false;
+    /* Some filesystems refuse to fsync directories, the rename is still in place */
+    bool result = fsync(fd) == 0 || errno == EINVAL || errno == EBADF;
+    close(fd);
+    return result;
+}
+
+bool hal_file_write_atomic(const char *path, const void *data, size_t size) {
+    if (!path || (!data && size))
+        return false;
+    char temp[HAL_MAX_PATH];
+    if (snprintf(temp, sizeof(temp), "%s.XXXXXX", path) >= (int)sizeof(temp))
+        return false;
+    hal_file_t file = {.fd=mkstemp(temp)};
+    if (!hal_io_valid(file))
+        return false;
+
+    struct stat st;
+    mode_t permissions = stat(path, &st) == 0 ? st.st_mode & 07777 : 0644;
+    bool result = fchmod(file.fd, permissions) == 0 &&
+                  (!size || hal_io_pwrite(file, data, size, 0) == size) &&
+                  hal_io_sync(file, HAL_SYNC_DATA, 0, 0);
+    result = hal_io_close(&file) && result;
+    if (result && hal_file_rename(temp, path, true))
+        return sync_parent_directory(path);
+    unlink(temp);
+    return false;
+}
+
+bool hal_file_map(hal_file_map_t *dst, const char *path, hal_file_map_hint_t hint) {
+    if (!dst || !path)
+        return false;
+    dst->data = NULL;
+    dst->size = 0;
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd == -1)
+        return false;
+    struct stat st;
+    if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode)) {
+        close(fd);
+        return false;
+    }
+    if (st.st_size == 0) {
+        close(fd);
+        return true;
+    }
+
+    /* The mapping keeps its own reference to the file */
+    void *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return false;
+
+    switch (hint) {
+        case HAL_FILE_MAP_SEQUENTIAL:
+            posix_madvise(data, (size_t)st.st_size, POSIX_MADV_SEQUENTIAL);
+            break;
+        case HAL_FILE_MAP_RANDOM:
+            posix_madvise(data, (size_t)st.st_size, POSIX_MADV_RANDOM);
+            break;
+        case HAL_FILE_MAP_WILLNEED:
+            posix_madvise(data, (size_t)st.st_size, POSIX_MADV_WILLNEED);
+            break;
+        default:
+            break;
+    }
+
+    dst->data = data;
+    dst->size = (size_t)st.st_size;
+    return true;
+}
+
+bool hal_file_unmap(hal_file_map_t *map) {
+    if (!map)
+        return false;
+    bool result = !map->data || munmap((void*)map->data, map->size) == 0;
+    map->data = NULL;
+    map->size = 0;
+    return result;
+}
+
 /* hal_directory_* functions */
 bool hal_directory_exists(const char *path) {
     if (!path)
@@ -343,7 +759,26 @@ bool hal_directory_delete(const char *path, bool recursive, bool and_files) {
 }
 
 bool hal_directory_rename(const char *old_path, const char *new_path, bool write_over) {
-    return hal_directory_copy(old_path, new_path, write_over, true);
+    if (!old_path || !new_path || !hal_directory_exists(old_path))
+        return false;
+    if ((write_over ? rename(old_path, new_path) : rename_noreplace(old_path, new_path, true)) == 0)
+        return true;
+    switch (errno) {
+        case EXDEV:
+            /* EXDEV is reported before the target is looked up */
+            if (!write_over && hal_path_exists(new_path))
+                return false;
+            break;
+        case EEXIST:
+        case ENOTEMPTY:
+            /* rename(2) only replaces empty directories, merge into populated ones */
+            if (!write_over || !hal_directory_exists(new_path))
+                return false;
+            break;
+        default:
+            return false;
+    }
+    return hal_directory_copy_ex(old_path, new_path, write_over, true, NULL);
 }
 
 bool hal_directory_copy(const char *src_path, const char *dst_path, bool write_over, bool delete_src) {
@@ -398,69 +833,821 @@ BAIL:
     return result;
 }
 
-int hal_directory_size(const char *path) {
-    if (!path || !hal_directory_exists(path))
-        return -1;
-    hal_dir_t d = {.path=path};
-    const char *name = NULL;
-    bool is_dir = false;
-    int total = 0;
-    while ((name = hal_directory_iter(&d, &is_dir)) != NULL) {
-        const char *full_path = hal_path_join(path, name);
-        if (!full_path) {
-            hal_directory_iter_end(&d);
-            return -1;
+/* Parallel directory copy/delete */
+#define HAL_FS_FILE_BATCH 64
+
+#ifdef HAL_FILESYSTEM_PARALLEL
+typedef hal_atomic64_t hal_fs_counter_t;
+#define fs_load(X) hal_atomic_load64(&(X), HAL_MEMORY_ACQUIRE)
+#define fs_store(X, V) hal_atomic_store64(&(X), V, HAL_MEMORY_RELEASE)
+#define fs_add(X, V) hal_atomic_fetch_add64(&(X), V, HAL_MEMORY_ACQ_REL)
+#define fs_sub(X, V) hal_atomic_fetch_add64(&(X), -(int64_t)(V), HAL_MEMORY_ACQ_REL)
+#define fs_lock(M) hal_mtx_lock(M)
+#define fs_unlock(M) hal_mtx_unlock(M)
+#else
+typedef int64_t hal_fs_counter_t;
+#define fs_load(X) (X)
+#define fs_store(X, V) ((X) = (V))
+#define fs_add(X, V) fs_fetch_add(&(X), (int64_t)(V))
+#define fs_sub(X, V) fs_fetch_add(&(X), -(int64_t)(V))
+#define fs_lock(M) ((void)0)
+#define fs_unlock(M) ((void)0)
+
+static int64_t fs_fetch_add(int64_t *counter, int64_t value) {
+    int64_t previous = *counter;
+    *counter += value;
+    return previous;
+}
+#endif
+
+typedef struct hal_fs_task {
+    char *src;
+    char *dst;                  /* NULL when deleting */
+    char *names;                /* File batch: NUL separated names inside src, NULL for a directory */
+    size_t names_size;
+    size_t num_names;
+    struct hal_fs_task *parent; /* Delete: directory waiting for this task */
+    bool root;                  /* Stats: the caller's directory, failures fail the job */
+    hal_fs_counter_t pending;   /* Delete: outstanding children, plus one for the task itself */
+    struct hal_fs_job *job;
+    struct hal_fs_task *next;   /* Serial: next task on the job's stack */
+} hal_fs_task_t;
+
+typedef struct hal_fs_job {
+    bool write_over;
+    void *context;              /* Extra state for run */
+    void (*run)(struct hal_fs_job *job, hal_fs_task_t *task);
+#ifdef HAL_FILESYSTEM_PARALLEL
+    hal_pool_t *pool;           /* NULL runs every task on the calling thread */
+    hal_pool_group_t *group;
+#endif
+    hal_fs_task_t *stack;
+    hal_fs_counter_t failed;
+} hal_fs_job_t;
+
+static void fs_task_free(hal_fs_task_t *task) {
+    free(task->src);
+    free(task->dst);
+    free(task->names);
+    free(task);
+}
+
+static hal_fs_task_t *fs_task_new(const char *src, const char *dst, hal_fs_task_t *parent) {
+    hal_fs_task_t *task = (hal_fs_task_t*)calloc(1, sizeof(hal_fs_task_t));
+    if (!task)
+        return NULL;
+    task->src = strdup(src);
+    task->dst = dst ? strdup(dst) : NULL;
+    task->parent = parent;
+    fs_store(task->pending, 1);
+    if (!task->src || (dst && !task->dst)) {
+        fs_task_free(task);
+        return NULL;
+    }
+    return task;
+}
+
+static bool fs_task_add_name(hal_fs_task_t *task, const char *name) {
+    size_t length = strlen(name) + 1;
+    char *names = (char*)realloc(task->names, task->names_size + length);
+    if (!names)
+        return false;
+    memcpy(names + task->names_size, name, length);
+    task->names = names;
+    task->names_size += length;
+    task->num_names++;
+    return true;
+}
+
+#ifdef HAL_FILESYSTEM_PARALLEL
+static void fs_task_main(void *userdata) {
+    hal_fs_task_t *task = (hal_fs_task_t*)userdata;
+    task->job->run(task->job, task);
+}
+#endif
+
+static bool fs_push(hal_fs_job_t *job, hal_fs_task_t *task) {
+    task->job = job;
+#ifdef HAL_FILESYSTEM_PARALLEL
+    if (job->pool)
+        return hal_pool_submit(job->pool, job->group, fs_task_main, task);
+#endif
+    /* Serial runs go depth first, like the pool's owner side */
+    task->next = job->stack;
+    job->stack = task;
+    return true;
+}
+
+/* Run root and everything it spawns. threads is 0 for the shared pool, 1 for the
+   calling thread alone, otherwise a pool of that size just for this call */
+static bool fs_run(hal_fs_task_t *root, const hal_directory_options_t *options, bool write_over, void *context,
+                   void (*run)(hal_fs_job_t*, hal_fs_task_t*)) {
+    hal_fs_job_t job;
+    memset(&job, 0, sizeof(job));
+    job.write_over = write_over;
+    job.context = context;
+    job.run = run;
+    fs_store(job.failed, false);
+#ifdef HAL_FILESYSTEM_PARALLEL
+    unsigned int threads = options ? options->threads : 0;
+    hal_pool_t *owned = NULL;
+    if (threads != 1)
+        job.pool = threads ? (owned = hal_pool_create(threads)) : hal_pool_shared();
+    /* Without a pool the tree is still processed, just serially */
+    if (job.pool && !(job.group = hal_pool_group_create(job.pool)))
+        job.pool = NULL;
+#else
+    (void)options;
+#endif
+
+    if (!fs_push(&job, root)) {
+        fs_task_free(root);
+        fs_store(job.failed, true);
+    }
+#ifdef HAL_FILESYSTEM_PARALLEL
+    if (job.pool)
+        hal_pool_wait(job.group);
+    hal_pool_group_destroy(job.group);
+    hal_pool_destroy(owned);
+#endif
+    hal_fs_task_t *task;
+    while ((task = job.stack) != NULL) {
+        job.stack = task->next;
+        run(&job, task);
+    }
+    return !fs_load(job.failed);
+}
+
+/* Directory entry type without following symlinks, using d_type when the filesystem fills it in */
+static bool fs_entry_is_dir(int dir_fd, struct dirent *entry, bool follow) {
+    struct stat st;
+    if (entry->d_type == DT_DIR)
+        return true;
+    if (entry->d_type != DT_UNKNOWN && !(follow && entry->d_type == DT_LNK))
+        return false;
+    return fstatat(dir_fd, entry->d_name, &st, follow ? 0 : AT_SYMLINK_NOFOLLOW) == 0 && S_ISDIR(st.st_mode);
+}
+
+static bool fs_join(char *buffer, size_t size, const char *dir, const char *name) {
+    return (size_t)snprintf(buffer, size, "%s" HAL_PATH_SEPARATOR_STR "%s", dir, name) < size;
+}
+
+/* Spawn a child task, file batches count as children of the directory they empty */
+static bool fs_spawn(hal_fs_job_t *job, hal_fs_task_t *parent, hal_fs_task_t *task) {
+    if (!task)
+        return false;
+    if (parent && !parent->dst) {
+        task->parent = parent;
+        fs_add(parent->pending, 1);
+    }
+    if (fs_push(job, task))
+        return true;
+    if (parent && !parent->dst)
+        fs_sub(parent->pending, 1);
+    fs_task_free(task);
+    return false;
+}
+
+static void fs_delete_done(hal_fs_job_t *job, hal_fs_task_t *task) {
+    /* Each directory is removed by whichever task finishes with it last */
+    while (task && fs_sub(task->pending, 1) == 1) {
+        hal_fs_task_t *parent = task->parent;
+        if (!task->names && rmdir(task->src) != 0)
+            fs_store(job->failed, true);
+        fs_task_free(task);
+        task = parent;
+    }
+}
+
+static void fs_run_delete(hal_fs_job_t *job, hal_fs_task_t *task) {
+    char path[HAL_MAX_PATH];
+    if (fs_load(job->failed)) {
+        fs_delete_done(job, task);
+        return;
+    }
+
+    if (task->names) {
+        const char *name = task->names;
+        for (size_t i = 0; i < task->num_names; i++, name += strlen(name) + 1)
+            if (!fs_join(path, sizeof(path), task->src, name) || unlink(path) != 0)
+                fs_store(job->failed, true);
+        fs_delete_done(job, task);
+        return;
+    }
+
+    DIR *dir = opendir(task->src);
+    if (!dir) {
+        fs_store(job->failed, true);
+        fs_delete_done(job, task);
+        return;
+    }
+    hal_fs_task_t *batch = NULL;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (!strcmp(entry->d_name, ".") || !strcmp(entry->d_name, ".."))
+            continue;
+        if (fs_entry_is_dir(dirfd(dir), entry, false)) {
+            if (!fs_join(path, sizeof(path), task->src, entry->d_name) ||
+                !fs_spawn(job, task, fs_task_new(path, NULL, NULL)))
+                fs_store(job->failed, true);
+            continue;
+        }
+        if (!batch && !(batch = fs_task_new(task->src, NULL, NULL))) {
+            fs_store(job->failed, true);
+            break;
+        }
+        if (!fs_task_add_name(batch, entry->d_name))
+            fs_store(job->failed, true);
+        if (batch->num_names == HAL_FS_FILE_BATCH) {
+            if (!fs_spawn(job, task, batch))
+                fs_store(job->failed, true);
+            batch = NULL;
         }
-        total += is_dir ? hal_directory_size(full_path) : hal_file_size(full_path);
-        free((void *)full_path);
     }
-    return total;
+    closedir(dir);
+    if (batch && !fs_spawn(job, task, batch))
+        fs_store(job->failed, true);
+    fs_delete_done(job, task);
 }
 
-int hal_directory_item_count(const char *path, bool recursive) {
+static void fs_run_copy(hal_fs_job_t *job, hal_fs_task_t *task) {
+    char src[HAL_MAX_PATH], dst[HAL_MAX_PATH];
+    if (fs_load(job->failed)) {
+        fs_task_free(task);
+        return;
+    }
+
+    if (task->names) {
+        const char *name = task->names;
+        for (size_t i = 0; i < task->num_names; i++, name += strlen(name) + 1)
+            if (!fs_join(src, sizeof(src), task->src, name) || !fs_join(dst, sizeof(dst), task->dst, name) ||
+                !hal_file_copy_ex(src, dst, job->write_over, NULL))
+                fs_store(job->failed, true);
+        fs_task_free(task);
+        return;
+    }
+
+    DIR *dir = opendir(task->src);
+    if (!dir) {
+        fs_store(job->failed, true);
+        fs_task_free(task);
+        return;
+    }
+    hal_fs_task_t *batch = NULL;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (!strcmp(entry->d_name, ".") || !strcmp(entry->d_name, ".."))
+            continue;
+        if (fs_entry_is_dir(dirfd(dir), entry, true)) {
+            if (!fs_join(src, sizeof(src), task->src, entry->d_name) ||
+                !fs_join(dst, sizeof(dst), task->dst, entry->d_name) ||
+                (mkdir(dst, 0755) != 0 && (errno != EEXIST || !hal_directory_exists(dst))) ||
+                !fs_spawn(job, NULL, fs_task_new(src, dst, NULL)))
+                fs_store(job->failed, true);
+            continue;
+        }
+        if (!batch && !(batch = fs_task_new(task->src, task->dst, NULL))) {
+            fs_store(job->failed, true);
+            break;
+        }
+        if (!fs_task_add_name(batch, entry->d_name))
+            fs_store(job->failed, true);
+        if (batch->num_names == HAL_FS_FILE_BATCH) {
+            if (!fs_spawn(job, NULL, batch))
+                fs_store(job->failed, true);
+            batch = NULL;
+        }
+    }
+    closedir(dir);
+    if (batch && !fs_spawn(job, NULL, batch))
+        fs_store(job->failed, true);
+    fs_task_free(task);
+}
+
+bool hal_directory_copy_ex(const char *src_path, const char *dst_path, bool write_over, bool delete_src, const hal_directory_options_t *options) {
+    if (!src_path || !dst_path || !hal_directory_exists(src_path))
+        return false;
+    if (mkdir(dst_path, 0755) != 0 && (errno != EEXIST || !hal_directory_exists(dst_path)))
+        return false;
+    hal_fs_task_t *root = fs_task_new(src_path, dst_path, NULL);
+    if (!root)
+        return false;
+    if (!fs_run(root, options, write_over, NULL, fs_run_copy))
+        return false;
+    return !delete_src || hal_directory_delete_ex(src_path, true, true, options);
+}
+
+bool hal_directory_delete_ex(const char *path, bool recursive, bool and_files, const hal_directory_options_t *options) {
+    if (!recursive)
+        return hal_directory_delete(path, false, and_files);
     if (!path || !hal_directory_exists(path))
+        return false;
+    hal_fs_task_t *root = fs_task_new(path, NULL, NULL);
+    if (!root)
+        return false;
+    return fs_run(root, options, false, NULL, fs_run_delete);
+}
+
+/* Directory walker */
+#define HAL_WALK_BUFFER_SIZE (64 * 1024)
+
+#if defined(__linux__)
+struct hal_linux_dirent64 {
+    uint64_t d_ino;
+    int64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[];
+};
+#endif
+
+typedef struct hal_walk_dir {
+    int fd;
+#if defined(__linux__)
+    char *buffer;
+    size_t offset, size;
+#else
+    DIR *dir;
+#endif
+} hal_walk_dir_t;
+
+typedef struct hal_walker {
+    int flags;
+    hal_walk_entry_callback callback;
+    void *userdata;
+    char *path;
+    size_t path_length, path_capacity;
+    int dir_fd;                 /* Directory of the entry being reported */
+    size_t name_length;
+#if defined(__linux__)
+    char **buffers;             /* One dirent buffer per depth, reused between siblings */
+    size_t num_buffers;
+#endif
+} hal_walker_t;
+
+static hal_path_type_t walk_type_from_mode(mode_t mode) {
+    if (S_ISREG(mode))
+        return HAL_PATH_FILE;
+    if (S_ISDIR(mode))
+        return HAL_PATH_DIRECTORY;
+    if (S_ISLNK(mode))
+        return HAL_PATH_SYMLINK;
+    return HAL_PATH_OTHER;
+}
+
+static hal_path_type_t walk_type_from_dirent(unsigned char type) {
+    switch (type) {
+        case DT_REG:
+            return HAL_PATH_FILE;
+        case DT_DIR:
+            return HAL_PATH_DIRECTORY;
+        case DT_LNK:
+            return HAL_PATH_SYMLINK;
+        case DT_UNKNOWN:
+            return HAL_PATH_UNKNOWN;
+        default:
+            return HAL_PATH_OTHER;
+    }
+}
+
+static void walk_fill_stat(hal_path_stat_t *dst, const struct stat *st) {
+    dst->type = walk_type_from_mode(st->st_mode);
+    dst->size = (uint64_t)st->st_size;
+    dst->blocks = (uint64_t)st->st_blocks;
+    dst->device = (uint64_t)st->st_dev;
+    dst->inode = (uint64_t)st->st_ino;
+    dst->links = (uint32_t)st->st_nlink;
+    dst->mode = (uint32_t)(st->st_mode & 07777);
+    dst->modified = (int64_t)st->st_mtime;
+}
+
+bool hal_path_stat(const char *path, hal_path_stat_t *dst, bool follow_links) {
+    struct stat st;
+    if (!path || !dst || (follow_links ? stat(path, &st) : lstat(path, &st)) != 0)
+        return false;
+    walk_fill_stat(dst, &st);
+    return true;
+}
+
+static bool walk_reserve(hal_walker_t *walker, size_t length) {
+    if (length <= walker->path_capacity)
+        return true;
+    size_t capacity = walker->path_capacity ? walker->path_capacity : 256;
+    while (capacity < length)
+        capacity *= 2;
+    char *path = (char*)realloc(walker->path, capacity);
+    if (!path)
+        return false;
+    walker->path = path;
+    walker->path_capacity = capacity;
+    return true;
+}
+
+const char* hal_walk_entry_path(hal_walk_entry_t *entry) {
+    if (!entry || !entry->walker)
+        return NULL;
+    hal_walker_t *walker = (hal_walker_t*)entry->walker;
+    if (!walk_reserve(walker, walker->path_length + walker->name_length + 2))
+        return NULL;
+    walker->path[walker->path_length] = HAL_PATH_SEPARATOR;
+    memcpy(walker->path + walker->path_length + 1, entry->name, walker->name_length + 1);
+    return walker->path;
+}
+
+const char* hal_walk_entry_dir(hal_walk_entry_t *entry) {
+    if (!entry || !entry->walker)
+        return NULL;
+    hal_walker_t *walker = (hal_walker_t*)entry->walker;
+    walker->path[walker->path_length] = '\0';
+    return walker->path;
+}
+
+const hal_path_stat_t* hal_walk_entry_stat(hal_walk_entry_t *entry) {
+    if (!entry || !entry->walker)
+        return NULL;
+    if (entry->has_stat)
+        return &entry->stat;
+    hal_walker_t *walker = (hal_walker_t*)entry->walker;
+    struct stat st;
+    int stat_flags = walker->flags & HAL_WALK_FOLLOW_LINKS ? 0 : AT_SYMLINK_NOFOLLOW;
+    if (fstatat(walker->dir_fd, entry->name, &st, stat_flags) != 0)
+        return NULL;
+    walk_fill_stat(&entry->stat, &st);
+    entry->has_stat = true;
+    return &entry->stat;
+}
+
+/* Start reading fd, buffer is a lazily allocated dirent buffer the caller keeps for reuse */
+static bool walk_dir_attach(hal_walk_dir_t *dir, int fd, char **buffer) {
+    dir->fd = fd;
+#if defined(__linux__)
+    if (!*buffer && !(*buffer = (char*)malloc(HAL_WALK_BUFFER_SIZE)))
+        return false;
+    dir->buffer = *buffer;
+    dir->offset = dir->size = 0;
+    return true;
+#else
+    (void)buffer;
+    return (dir->dir = fdopendir(fd)) != NULL;
+#endif
+}
+
+static bool walk_dir_open(hal_walker_t *walker, hal_walk_dir_t *dir, int fd, size_t depth) {
+#if defined(__linux__)
+    if (depth >= walker->num_buffers) {
+        char **buffers = (char**)realloc(walker->buffers, (depth + 1) * sizeof(char*));
+        if (!buffers)
+            return false;
+        walker->buffers = buffers;
+        while (walker->num_buffers <= depth)
+            walker->buffers[walker->num_buffers++] = NULL;
+    }
+    return walk_dir_attach(dir, fd, &walker->buffers[depth]);
+#else
+    char *buffer = NULL;
+    (void)walker;
+    (void)depth;
+    return walk_dir_attach(dir, fd, &buffer);
+#endif
+}
+
+static void walk_dir_close(hal_walk_dir_t *dir) {
+#if defined(__linux__)
+    close(dir->fd);
+#else
+    closedir(dir->dir);
+#endif
+}
+
+static const char* walk_dir_next(hal_walk_dir_t *dir, unsigned char *type, size_t *length) {
+    for (;;) {
+#if defined(__linux__)
+        if (dir->offset >= dir->size) {
+            long result = syscall(SYS_getdents64, dir->fd, dir->buffer, HAL_WALK_BUFFER_SIZE);
+            if (result <= 0)
+                return NULL;
+            dir->size = (size_t)result;
+            dir->offset = 0;
+        }
+        struct hal_linux_dirent64 *entry = (struct hal_linux_dirent64*)(dir->buffer + dir->offset);
+        dir->offset += entry->d_reclen;
+#else
+        struct dirent *entry = readdir(dir->dir);
+        if (!entry)
+            return NULL;
+#endif
+        const char *name = entry->d_name;
+        if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0')))
+            continue;
+        *type = entry->d_type;
+        *length = strlen(name);
+        return name;
+    }
+}
+
+static int walk_directory(hal_walker_t *walker, int fd, size_t depth) {
+    hal_walk_dir_t dir;
+    if (!walk_dir_open(walker, &dir, fd, depth)) {
+        close(fd);
         return -1;
-    hal_dir_t d = {.path=path};
-    const char *name = NULL;
-    bool is_dir = false;
-    int total = 0;
-    while ((name = hal_directory_iter(&d, &is_dir)) != NULL) {
-        total++;
-        if (is_dir && recursive) {
-            const char *full_path = hal_path_join(path, name);
-            if (!full_path) {
-                hal_directory_iter_end(&d);
-                return -1;
-            }
-            total += hal_directory_file_count(full_path, true);
-            free((void *)full_path);
+    }
+#if !defined(__linux__)
+    fd = dirfd(dir.dir);
+#endif
+
+    int result = HAL_WALK_CONTINUE;
+    const char *name;
+    unsigned char d_type;
+    size_t length;
+    bool follow = walker->flags & HAL_WALK_FOLLOW_LINKS;
+    while ((name = walk_dir_next(&dir, &d_type, &length)) != NULL) {
+        hal_walk_entry_t entry = {
+            .name = name,
+            .depth = depth,
+            .type = walk_type_from_dirent(d_type),
+            .has_stat = false,
+            .walker = walker
+        };
+        walker->dir_fd = fd;
+        walker->name_length = length;
+        /* Only stat when the listing can't answer the question */
+        if ((walker->flags & HAL_WALK_STAT) || entry.type == HAL_PATH_UNKNOWN ||
+            (follow && entry.type == HAL_PATH_SYMLINK)) {
+            if (hal_walk_entry_stat(&entry))
+                entry.type = entry.stat.type;
+        }
+
+        bool is_dir = entry.type == HAL_PATH_DIRECTORY;
+        int action = HAL_WALK_CONTINUE;
+        if (!is_dir || (walker->flags & HAL_WALK_DIRECTORIES))
+            action = walker->callback(&entry, walker->userdata);
+        if (action != HAL_WALK_CONTINUE && action != HAL_WALK_SKIP) {
+            result = HAL_WALK_STOP;
+            break;
         }
+        if (!is_dir || action == HAL_WALK_SKIP || !(walker->flags & HAL_WALK_RECURSIVE))
+            continue;
+
+        int child = openat(fd, name, O_RDONLY | O_DIRECTORY | O_CLOEXEC | (follow ? 0 : O_NOFOLLOW));
+        if (child < 0)
+            continue;
+        size_t saved = walker->path_length;
+        if (!walk_reserve(walker, saved + length + 2)) {
+            close(child);
+            result = -1;
+            break;
+        }
+        walker->path[saved] = HAL_PATH_SEPARATOR;
+        memcpy(walker->path + saved + 1, name, length);
+        walker->path_length = saved + 1 + length;
+        result = walk_directory(walker, child, depth + 1);
+        walker->path_length = saved;
+        if (result != HAL_WALK_CONTINUE)
+            break;
     }
-    return total;
+    walk_dir_close(&dir);
+    return result;
+}
+
+bool hal_path_walk_ex(const char *path, int flags, hal_walk_entry_callback callback, void *userdata) {
+    if (!path || !callback)
+        return false;
+    int fd = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0)
+        return false;
+
+    hal_walker_t walker;
+    memset(&walker, 0, sizeof(walker));
+    walker.flags = flags;
+    walker.callback = callback;
+    walker.userdata = userdata;
+    size_t length = strlen(path);
+    while (length > 1 && path[length - 1] == HAL_PATH_SEPARATOR)
+        length--;
+    if (!walk_reserve(&walker, length + 1)) {
+        close(fd);
+        return false;
+    }
+    memcpy(walker.path, path, length);
+    walker.path[length] = '\0';
+    walker.path_length = length;
+
+    int result = walk_directory(&walker, fd, 0);
+    free(walker.path);
+#if defined(__linux__)
+    for (size_t i = 0; i < walker.num_buffers; i++)
+        free(walker.buffers[i]);
+    free(walker.buffers);
+#endif
+    return result == HAL_WALK_CONTINUE;
+}
+
+/* Same totals as the old readdir loop: every entry that isn't a directory adds
+   hal_file_size, which follows links, and linked directories aren't descended */
+static int walk_size(hal_walk_entry_t *entry, void *userdata) {
+    if (entry->type == HAL_PATH_DIRECTORY)
+        return HAL_WALK_CONTINUE;
+    const hal_path_stat_t *st = entry->type == HAL_PATH_SYMLINK ? NULL : hal_walk_entry_stat(entry);
+    *(int*)userdata += st ? (int)st->size : hal_file_size(hal_walk_entry_path(entry));
+    return HAL_WALK_CONTINUE;
+}
+
+static int walk_count(hal_walk_entry_t *entry, void *userdata) {
+    (void)entry;
+    (*(int*)userdata)++;
+    return HAL_WALK_CONTINUE;
+}
+
+int hal_directory_size(const char *path) {
+    int total = 0;
+    return hal_path_walk_ex(path, HAL_WALK_RECURSIVE, walk_size, &total) ? total : -1;
+}
+
+int hal_directory_item_count(const char *path, bool recursive) {
+    int total = 0;
+    int flags = HAL_WALK_DIRECTORIES | (recursive ? HAL_WALK_RECURSIVE : 0);
+    return hal_path_walk_ex(path, flags, walk_count, &total) ? total : -1;
 }
 
 int hal_directory_file_count(const char *path, bool recursive) {
-    if (!path || !hal_directory_exists(path))
-        return -1;
-    hal_dir_t d = {.path=path};
-    const char *name = NULL;
-    bool is_dir = false;
     int total = 0;
-    while ((name = hal_directory_iter(&d, &is_dir)) != NULL) {
+    return hal_path_walk_ex(path, recursive ? HAL_WALK_RECURSIVE : 0, walk_count, &total) ? total : -1;
+}
+
+/* Directory statistics */
+typedef struct hal_inode_slot {
+    uint64_t device, inode;
+    bool used;
+} hal_inode_slot_t;
+
+/* (dev, ino) pairs of multiply linked files already counted */
+typedef struct hal_inode_set {
+#ifdef HAL_FILESYSTEM_PARALLEL
+    hal_mtx_t lock;
+#endif
+    hal_inode_slot_t *slots;
+    size_t count, capacity;
+} hal_inode_set_t;
+
+typedef struct hal_stats_context {
+    hal_fs_counter_t bytes, blocks, files, directories;
+    hal_inode_set_t *links;
+#ifdef HAL_FILESYSTEM_PARALLEL
+    hal_mtx_t lock;
+#endif
+    char *buffers;              /* Idle dirent buffers, chained through their first bytes */
+} hal_stats_context_t;
+
+static size_t inode_hash(uint64_t device, uint64_t inode) {
+    uint64_t x = inode ^ (device * 0x9E3779B97F4A7C15ULL);
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return (size_t)(x ^ (x >> 31));
+}
+
+static bool inode_set_place(hal_inode_slot_t *slots, size_t capacity, uint64_t device, uint64_t inode) {
+    size_t i = inode_hash(device, inode) & (capacity - 1);
+    for (; slots[i].used; i = (i + 1) & (capacity - 1))
+        if (slots[i].device == device && slots[i].inode == inode)
+            return false;
+    slots[i].device = device;
+    slots[i].inode = inode;
+    slots[i].used = true;
+    return true;
+}
+
+/* Returns true the first time a file is seen, allocation failures count as unseen */
+static bool inode_set_insert(hal_inode_set_t *set, uint64_t device, uint64_t inode) {
+    bool inserted = true;
+    fs_lock(&set->lock);
+    if ((set->count + 1) * 2 > set->capacity) {
+        size_t capacity = set->capacity ? set->capacity * 2 : 256;
+        hal_inode_slot_t *slots = (hal_inode_slot_t*)calloc(capacity, sizeof(hal_inode_slot_t));
+        if (!slots)
+            goto BAIL;
+        for (size_t i = 0; i < set->capacity; i++)
+            if (set->slots[i].used)
+                inode_set_place(slots, capacity, set->slots[i].device, set->slots[i].inode);
+        free(set->slots);
+        set->slots = slots;
+        set->capacity = capacity;
+    }
+    if ((inserted = inode_set_place(set->slots, set->capacity, device, inode)))
+        set->count++;
+BAIL:
+    fs_unlock(&set->lock);
+    return inserted;
+}
+
+static char* stats_buffer_take(hal_stats_context_t *context) {
+    fs_lock(&context->lock);
+    char *buffer = context->buffers;
+    if (buffer)
+        memcpy(&context->buffers, buffer, sizeof(char*));
+    fs_unlock(&context->lock);
+    return buffer;
+}
+
+static void stats_buffer_give(hal_stats_context_t *context, char *buffer) {
+    if (!buffer)
+        return;
+    fs_lock(&context->lock);
+    memcpy(buffer, &context->buffers, sizeof(char*));
+    context->buffers = buffer;
+    fs_unlock(&context->lock);
+}
+
+static void fs_run_stats(hal_fs_job_t *job, hal_fs_task_t *task) {
+    hal_stats_context_t *context = (hal_stats_context_t*)job->context;
+    hal_directory_stats_t local;
+    char path[HAL_MAX_PATH];
+    struct stat st;
+    hal_walk_dir_t dir;
+
+    /* Unreadable subdirectories are skipped, same as hal_path_walk_ex. The root
+       follows links like hal_directory_exists, links below it are not descended */
+    char *buffer = stats_buffer_take(context);
+    int fd = open(task->src, O_RDONLY | O_DIRECTORY | O_CLOEXEC | (task->root ? 0 : O_NOFOLLOW));
+    if (fd < 0 || !walk_dir_attach(&dir, fd, &buffer)) {
+        if (fd >= 0)
+            close(fd);
+        if (task->root)
+            fs_store(job->failed, true);
+        stats_buffer_give(context, buffer);
+        fs_task_free(task);
+        return;
+    }
+#if !defined(__linux__)
+    fd = dirfd(dir.dir);
+#endif
+    memset(&local, 0, sizeof(local));
+    if (fstat(fd, &st) == 0)
+        local.blocks += (uint64_t)st.st_blocks;
+
+    const char *name;
+    unsigned char d_type;
+    size_t length;
+    while ((name = walk_dir_next(&dir, &d_type, &length)) != NULL) {
+        bool is_dir = d_type == DT_DIR;
+        if (!is_dir) {
+            if (fstatat(fd, name, &st, AT_SYMLINK_NOFOLLOW) != 0)
+                continue;
+            is_dir = S_ISDIR(st.st_mode);
+        }
         if (is_dir) {
-            if (recursive) {
-                const char *full_path = hal_path_join(path, name);
-                if (!full_path) {
-                    hal_directory_iter_end(&d);
-                    return -1;
-                }
-                total += hal_directory_file_count(full_path, true);
-                free((void*)full_path);
-            }
-        } else
-            total++;
+            local.directories++;
+            if (!fs_join(path, sizeof(path), task->src, name) ||
+                !fs_spawn(job, NULL, fs_task_new(path, NULL, NULL)))
+                fs_store(job->failed, true);
+            continue;
+        }
+        if (context->links && st.st_nlink > 1 &&
+            !inode_set_insert(context->links, (uint64_t)st.st_dev, (uint64_t)st.st_ino))
+            continue;
+        local.files++;
+        local.blocks += (uint64_t)st.st_blocks;
+        if (S_ISREG(st.st_mode))
+            local.bytes += (uint64_t)st.st_size;
     }
-    return total;
+    walk_dir_close(&dir);
+    stats_buffer_give(context, buffer);
+    fs_add(context->bytes, (int64_t)local.bytes);
+    fs_add(context->blocks, (int64_t)local.blocks);
+    fs_add(context->files, (int64_t)local.files);
+    fs_add(context->directories, (int64_t)local.directories);
+    fs_task_free(task);
+}
+
+bool hal_directory_stats(const char *path, hal_directory_stats_t *dst, bool dedup_links, const hal_directory_options_t *options) {
+    if (!path || !dst || !hal_directory_exists(path))
+        return false;
+    hal_inode_set_t links;
+    memset(&links, 0, sizeof(links));
+    hal_stats_context_t context;
+    memset(&context, 0, sizeof(context));
+    context.links = dedup_links ? &links : NULL;
+#ifdef HAL_FILESYSTEM_PARALLEL
+    hal_mtx_init(&links.lock, HAL_MTX_PLAIN);
+    hal_mtx_init(&context.lock, HAL_MTX_PLAIN);
+#endif
+
+    hal_fs_task_t *root = fs_task_new(path, NULL, NULL);
+    if (root)
+        root->root = true;
+    bool result = root && fs_run(root, options, false, &context, fs_run_stats);
+    dst->bytes = (uint64_t)fs_load(context.bytes);
+    dst->blocks = (uint64_t)fs_load(context.blocks);
+    dst->files = (uint64_t)fs_load(context.files);
+    dst->directories = (uint64_t)fs_load(context.directories);
+    char *buffer;
+    while ((buffer = stats_buffer_take(&context)) != NULL)
+        free(buffer);
+#ifdef HAL_FILESYSTEM_PARALLEL
+    hal_mtx_destroy(&context.lock);
+    hal_mtx_destroy(&links.lock);
+#endif
+    free(links.slots);
+    return result;
 }
 
 /* directory iteration */
@@ -710,196 +1897,22 @@ BAIL:
     return parts;
 }
 
-/* Glob functions */
-static int simple_match(const char *pat, const char *s) {
-    if (!pat)
-        return s && *s == '\0';
-    if (*pat == '\0')
-        return *s == '\0';
-    if (*pat == '*') {
-        while (*(pat + 1) == '*')
-            pat++;
-        if (*(pat+1) == '\0') return 1;
-        for (const char *p = s; *p; ++p)
-            if (simple_match(pat + 1, p))
-                return 1;
-        return 0;
-    } else if (*pat == '?') {
-        return *s && simple_match(pat+1, s+1);
-    } else {
-        if (*pat == *s)
-            return simple_match(pat + 1, s + 1);
-        return 0;
-    }
-}
-
-struct collect_ctx {
-    char **out;
-    int n;
-    int cap;
-};
-
-static void collect_add(struct collect_ctx *c, const char *full) {
-    if (c->n >= c->cap) {
-        int newcap = c->cap == 0 ? 8 : c->cap * 2;
-        char **tmp = (char **)realloc(c->out, newcap * sizeof(char*));
-        if (!tmp)
-            return;
-        c->out = tmp;
-        c->cap = newcap;
-    }
-    c->out[c->n++] = strdup(full);
-}
-
-static void walk_and_match(const char *base, const char *suffix_pat, struct collect_ctx *c) {
-    DIR *d = opendir(base);
-    if (!d)
-        return;
-    struct dirent *ent;
-    while ((ent = readdir(d)) != NULL) {
-        if (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0)
-            continue;
-        char full[4096];
-        snprintf(full, sizeof(full), "%s/%s", base, ent->d_name);
-        struct stat st;
-        if (stat(full, &st) == -1)
-            continue;
-        if (S_ISDIR(st.st_mode))
-            walk_and_match(full, suffix_pat, c);
-        else if (S_ISREG(st.st_mode) && simple_match(suffix_pat, ent->d_name))
-            collect_add(c, full);
-    }
-    closedir(d);
-}
-
-const char** hal_directory_glob(const char *pattern, int *count) {
-    if (!pattern) return NULL;
-    struct collect_ctx c = {0};
-    const char *ddstar = strstr(pattern, "**");
-    if (ddstar) {
-        const char *slash_before = ddstar;
-        while (slash_before > pattern && *slash_before != '/')
-            --slash_before;
-        size_t base_len = 0;
-        const char *suffix_pat = NULL;
-        if (*slash_before == '/') {
-            base_len = slash_before - pattern;
-            suffix_pat = ddstar + 2;
-            if (*suffix_pat == '/')
-                suffix_pat++;
-        } else {
-            base_len = 0;
-            suffix_pat = ddstar + 2;
-            if (*suffix_pat == '/')
-                suffix_pat++;
-        }
-        char base[4096];
-        if (base_len == 0)
-            strcpy(base, ".");
-        else {
-            strncpy(base, pattern, base_len);
-            base[base_len] = '\0';
-        }
-        walk_and_match(base, suffix_pat, &c);
-    } else {
-        const char *last = strrchr(pattern, '/');
-        char dir[4096];
-        const char *filepat = NULL;
-        if (last) {
-            size_t dlen = last - pattern;
-            if (dlen == 0)
-                strcpy(dir, "/");
-            else {
-                strncpy(dir, pattern, dlen);
-                dir[dlen] = '\0';
-            }
-            filepat = last + 1;
-        } else { strcpy(dir, "."); filepat = pattern; }
-        DIR *d = opendir(dir);
-        if (d) {
-            struct dirent *ent;
-            while ((ent = readdir(d)) != NULL) {
-                if (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0) continue;
-                char full[4096];
-                snprintf(full, sizeof(full), "%s/%s", dir, ent->d_name);
-                struct stat st;
-                if (stat(full, &st) == -1)
-                    continue;
-                if (S_ISREG(st.st_mode)) {
-                    if (simple_match(filepat, ent->d_name))
-                        collect_add(&c, full);
-                } else if (S_ISDIR(st.st_mode))
-                    walk_and_match(full, filepat, &c);
-            }
-            closedir(d);
-        }
-    }
-    if (count)
-        *count = c.n;
-    if (c.n == 0)
-        return NULL;
-    char **out = (char **)realloc(c.out, c.n * sizeof(char *));
-    if (out)
-        c.out = out;
-    return (const char**)c.out;
-}
+/* hal_path_walk */
+typedef struct hal_walk_legacy {
+    hal_walk_callback callback;
+    void *userdata;
+} hal_walk_legacy_t;
 
-/* hal_path_glob and hal_path_walk */
-bool hal_path_glob(const char *pattern, hal_glob_callback callback, void *userdata) {
-    if (!pattern || !callback)
-        return false;
-    
-    int count = 0;
-    const char **matches = hal_directory_glob(pattern, &count);
-    if (!matches)
-        return true;
-    
-    bool result = true;
-    for (int i = 0; i < count; i++) {
-        const char *filename = hal_path_filename(matches[i]);
-        const char *dirname = hal_path_dirname(matches[i]);
-        if (callback(dirname ? dirname : ".", filename, userdata) != 0) {
-            result = false;
-        }
-        if (dirname)
-            free((void*)dirname);
-        free((void*)matches[i]);
-    }
-    free(matches);
-    return result;
+static int walk_legacy(hal_walk_entry_t *entry, void *userdata) {
+    hal_walk_legacy_t *legacy = (hal_walk_legacy_t*)userdata;
+    return legacy->callback(hal_walk_entry_dir(entry), entry->name, legacy->userdata) != 0 ? HAL_WALK_STOP : HAL_WALK_CONTINUE;
 }
 
 bool hal_path_walk(const char *path, bool recursive, hal_walk_callback callback, void *userdata) {
-    if (!path || !hal_directory_exists(path) || !callback)
+    if (!callback)
         return false;
-    
-    hal_dir_t d = {.path = path};
-    const char *name = NULL;
-    bool is_dir = false;
-    
-    while ((name = hal_directory_iter(&d, &is_dir)) != NULL) {
-        const char *full_path = hal_path_join(path, name);
-        if (!full_path)
-            continue;
-        
-        if (is_dir) {
-            if (recursive) {
-                if (!hal_path_walk(full_path, recursive, callback, userdata)) {
-                    free((void*)full_path);
-                    hal_directory_iter_end(&d);
-                    return false;
-                }
-            }
-        } else {
-            if (callback(path, name, userdata) != 0) {
-                free((void*)full_path);
-                hal_directory_iter_end(&d);
-                return false;
-            }
-        }
-        free((void*)full_path);
-    }
-    return true;
+    hal_walk_legacy_t legacy = {.callback = callback, .userdata = userdata};
+    return hal_path_walk_ex(path, recursive ? HAL_WALK_RECURSIVE : 0, walk_legacy, &legacy);
 }
 
 #endif /* HAL_NO_FILESYSTEM */
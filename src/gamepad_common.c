@@ -1,7 +1,14 @@
 /* https://github.com/takeiteasy/hal */
 
+#ifndef HAL_NO_THREADS
+#define HAL_GAMEPAD_FILTER_LOCK
+#endif
 #include "gamepad_common.h"
+#ifdef HAL_GAMEPAD_FILTER_LOCK
+#include "hal/threads.h"
+#endif
 #include <stddef.h>
+#include <string.h>
 
 /* Callback storage definitions */
 hal_gamepad_attach_callback_t hal_gamepad_attach_cb = NULL;
@@ -16,6 +23,33 @@ void *hal_gamepad_button_down_ctx = NULL;
 void *hal_gamepad_button_up_ctx = NULL;
 void *hal_gamepad_axis_ctx = NULL;
 
+/* Input reading strategy */
+hal_gamepad_io_mode_t hal_gamepad_io_mode = HAL_GAMEPAD_IO_THREAD_PER_DEVICE;
+
+/* Event queue settings */
+unsigned int hal_gamepad_queue_capacity = 1024;
+hal_gamepad_overflow_t hal_gamepad_queue_policy = HAL_GAMEPAD_OVERFLOW_DROP_OLDEST;
+
+/* Axis filtering */
+typedef struct {
+    float deadzone;
+    float epsilon;
+} hal_gamepad_axis_filter_t;
+
+static hal_gamepad_axis_filter_t default_axis_filter = { 0.0f, 0.0f };
+bool hal_gamepad_raw_axes = false;
+
+/* Filters are set by the application while backend threads filter samples,
+   so the default and per-device settings are only touched with this held */
+#ifdef HAL_GAMEPAD_FILTER_LOCK
+static hal_lock_t filter_lock = HAL_LOCK_INIT;
+#define FILTER_LOCK() hal_lock_lock(&filter_lock)
+#define FILTER_UNLOCK() hal_lock_unlock(&filter_lock)
+#else
+#define FILTER_LOCK()
+#define FILTER_UNLOCK()
+#endif
+
 /* Callback registration implementations */
 void hal_gamepad_set_attach_callback(hal_gamepad_attach_callback_t callback, void *context) {
     hal_gamepad_attach_cb = callback;
@@ -41,3 +75,109 @@ void hal_gamepad_set_axis_callback(hal_gamepad_axis_callback_t callback, void *c
     hal_gamepad_axis_cb = callback;
     hal_gamepad_axis_ctx = context;
 }
+
+void hal_gamepad_set_axis_filter(hal_gamepad_device_t *device, int axis_id, float deadzone, float epsilon) {
+    hal_gamepad_axis_filter_t filter = { deadzone < 0.0f ? 0.0f : deadzone, epsilon < 0.0f ? 0.0f : epsilon };
+    if (filter.deadzone > 0.99f)
+        filter.deadzone = 0.99f;
+
+    if (device == NULL) {
+        FILTER_LOCK();
+        default_axis_filter = filter;
+        FILTER_UNLOCK();
+        return;
+    }
+    if (device->num_axes == 0 || (axis_id >= 0 && (unsigned int)axis_id >= device->num_axes))
+        return;
+
+    /* Allocated once and kept until the device is disposed, so readers never see it freed */
+    FILTER_LOCK();
+    hal_gamepad_axis_filter_t *filters = device->axis_filters;
+    if (filters == NULL) {
+        if (!(filters = malloc(sizeof(hal_gamepad_axis_filter_t) * device->num_axes))) {
+            FILTER_UNLOCK();
+            return;
+        }
+        for (unsigned int i = 0; i < device->num_axes; i++)
+            filters[i] = default_axis_filter;
+        device->axis_filters = filters;
+    }
+    for (unsigned int i = 0; i < device->num_axes; i++)
+        if (axis_id < 0 || (unsigned int)axis_id == i)
+            filters[i] = filter;
+    FILTER_UNLOCK();
+}
+
+void hal_gamepad_set_raw_axis_events(bool raw) {
+    hal_gamepad_raw_axes = raw;
+}
+
+bool hal_gamepad_filter_axis(hal_gamepad_device_t *device, unsigned int axis_id, float *value) {
+    if (hal_gamepad_raw_axes)
+        return true;
+
+    FILTER_LOCK();
+    const hal_gamepad_axis_filter_t *filters = device->axis_filters;
+    hal_gamepad_axis_filter_t filter = filters != NULL && axis_id < device->num_axes ? filters[axis_id] : default_axis_filter;
+    FILTER_UNLOCK();
+    float v = *value;
+
+    if (filter.deadzone > 0.0f) {
+        float magnitude = v < 0.0f ? -v : v;
+        if (magnitude < filter.deadzone)
+            v = 0.0f;
+        else
+            v = (v < 0.0f ? -1.0f : 1.0f) * (magnitude - filter.deadzone) / (1.0f - filter.deadzone);
+    }
+
+    float last = axis_id < device->num_axes ? device->axis_states[axis_id] : 0.0f;
+    float delta = v - last;
+    if (delta < 0.0f)
+        delta = -delta;
+    /* Always let the rest position and the extremes through so they are reachable */
+    if (delta == 0.0f || (delta < filter.epsilon && v != 0.0f && v != 1.0f && v != -1.0f))
+        return false;
+
+    *value = v;
+    return true;
+}
+
+size_t hal_gamepad_drain_queued_events(hal_gamepad_queued_event_t *queue, size_t *count, hal_gamepad_event_t *out, size_t max) {
+    size_t n = *count < max ? *count : max;
+
+    for (size_t i = 0; i < n; i++) {
+        out[i].event_type = queue[i].event_type;
+        if (queue[i].event_type == HAL_GAMEPAD_EVENT_AXIS_MOVED) {
+            hal_gamepad_axis_event_t *e = queue[i].event_data;
+            out[i].device = e->device;
+            out[i].timestamp = e->timestamp;
+            out[i].axis.axis_id = e->axis_id;
+            out[i].axis.value = e->value;
+            out[i].axis.last_value = e->last_value;
+        } else {
+            hal_gamepad_button_event_t *e = queue[i].event_data;
+            out[i].device = e->device;
+            out[i].timestamp = e->timestamp;
+            out[i].button.button_id = e->button_id;
+        }
+        free(queue[i].event_data);
+    }
+
+    *count -= n;
+    memmove(queue, queue + n, sizeof(hal_gamepad_queued_event_t) * *count);
+    return n;
+}
+
+void hal_gamepad_set_event_queue(unsigned int capacity, hal_gamepad_overflow_t policy) {
+    if (capacity > 0) {
+        unsigned int rounded = 1;
+        while (rounded < capacity && rounded < (1u << 31))
+            rounded <<= 1;
+        hal_gamepad_queue_capacity = rounded;
+    }
+    hal_gamepad_queue_policy = policy;
+}
+
+void hal_gamepad_set_io_mode(hal_gamepad_io_mode_t mode) {
+    hal_gamepad_io_mode = mode;
+}
@@ -37,16 +37,28 @@ extern void *hal_gamepad_button_down_ctx;
 extern void *hal_gamepad_button_up_ctx;
 extern void *hal_gamepad_axis_ctx;
 
+/* Input reading strategy from hal_gamepad_set_io_mode */
+extern hal_gamepad_io_mode_t hal_gamepad_io_mode;
+
+/* Event queue settings from hal_gamepad_set_event_queue */
+extern unsigned int hal_gamepad_queue_capacity;
+extern hal_gamepad_overflow_t hal_gamepad_queue_policy;
+
+/* Axis filtering from hal_gamepad_set_axis_filter and hal_gamepad_set_raw_axis_events */
+extern bool hal_gamepad_raw_axes;
+/* Apply deadzone and epsilon to a new sample of an axis. Returns false if the
+   change should not be reported; otherwise *value holds the value to report. */
+bool hal_gamepad_filter_axis(hal_gamepad_device_t *device, unsigned int axis_id, float *value);
+
 /* Callback registration implementations moved to gamepad_common.c */
 
-/* Event types for queued events */
-typedef enum {
-    HAL_GAMEPAD_EVENT_ATTACHED,
-    HAL_GAMEPAD_EVENT_REMOVED,
-    HAL_GAMEPAD_EVENT_BUTTON_DOWN,
-    HAL_GAMEPAD_EVENT_BUTTON_UP,
-    HAL_GAMEPAD_EVENT_AXIS_MOVED
-} hal_gamepad_event_type_t;
+/* Mapping index - implemented in gamepad_mapping.c */
+/* Build the GUID index over the builtin mappings (idempotent) */
+void hal_gamepad_mapping_init(void);
+/* Look up and attach the mapping for a device; call once vendor/product are known */
+void hal_gamepad_resolve_mapping(hal_gamepad_device_t *device);
+/* Fill a snapshot from the device's current state without synchronization */
+void hal_gamepad_fill_snapshot(hal_gamepad_device_t *device, hal_gamepad_snapshot_t *snapshot);
 
 /* Button event data */
 typedef struct {
@@ -72,4 +84,8 @@ typedef struct {
     void *event_data;
 } hal_gamepad_queued_event_t;
 
+/* Move up to max button/axis events from a queue of heap-allocated events into
+   out, freeing their data and keeping the remainder queued. Returns the count. */
+size_t hal_gamepad_drain_queued_events(hal_gamepad_queued_event_t *queue, size_t *count, hal_gamepad_event_t *out, size_t max);
+
 #endif /* HAL_GAMEPAD_COMMON_H */
@@ -18,13 +18,7 @@
 /* Gamepad mapping implementation - translates raw input to standard layout */
 
 #ifndef HAL_NO_GAMEPAD
-#include "hal/gamepad.h"
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <ctype.h>
-
-/* Define platform macro for mapping selection */
+/* Define platform macro for mapping selection (must precede gamepad.h) */
 #if defined(_WIN32) || defined(_WIN64)
   #define HAL_PLATFORM_WINDOWS
 #elif defined(__APPLE__)
@@ -42,24 +36,75 @@
   #define HAL_PLATFORM_WEB
 #endif
 
-/* Mapping entry for a single device */
+/* Checked before gamepad.h, which disables every other module */
+#ifndef HAL_NO_THREADS
+#define HAL_GAMEPAD_MAPPING_LOCK
+#endif
+
+#include "gamepad_common.h"
+#ifdef HAL_GAMEPAD_MAPPING_LOCK
+#include "hal/threads.h"
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+
+/* Pre-parsed bindings for a single device, -1 means unmapped */
+typedef struct {
+    int8_t button_map[HAL_GAMEPAD_BUTTON_MAX];
+    int8_t axis_map[HAL_GAMEPAD_AXIS_MAX];
+    /* Hat switch mappings for D-pad */
+    int8_t hat_map[4]; /* up, down, left, right -> hat mask */
+    /* Axis-as-button mappings (for triggers treated as buttons) */
+    int8_t axis_button_map[HAL_GAMEPAD_BUTTON_MAX];
+    uint16_t axis_button_inverted; /* one bit per button */
+} hal_gamepad_bindings_t;
+
+/* Builtin mapping record, emitted pre-parsed by mappings.py */
+typedef struct {
+    uint8_t guid[16];
+    hal_gamepad_bindings_t bindings;
+    uint16_t string_index; /* into hal_gamepad_builtin_mappings */
+} hal_gamepad_builtin_mapping_t;
+
+#include "gamepad_mappings.h"
+
+/* Custom mapping added at runtime */
 typedef struct {
     char guid[33];
     char *name;
     char *mapping_string;
-    int button_map[HAL_GAMEPAD_BUTTON_MAX];
-    int axis_map[HAL_GAMEPAD_AXIS_MAX];
-    /* Hat switch mappings for D-pad */
-    int hat_map[4]; /* up, down, left, right -> hat index */
-    /* Axis-as-button mappings (for triggers treated as buttons) */
-    int axis_button_map[HAL_GAMEPAD_BUTTON_MAX];
-    bool axis_button_inverted[HAL_GAMEPAD_BUTTON_MAX];
+    hal_gamepad_bindings_t bindings;
 } hal_gamepad_mapping_t;
 
-/* Dynamic array of custom mappings */
-static hal_gamepad_mapping_t *custom_mappings = NULL;
-static unsigned int custom_mapping_count = 0;
-static unsigned int custom_mapping_capacity = 0;
+/* Index entry for a single GUID - nodes are never freed so devices can keep
+   pointing at them, and a custom mapping added later is seen immediately */
+typedef struct hal_gamepad_mapping_entry {
+    char guid[33];
+    unsigned int hash;
+    hal_gamepad_mapping_t *custom;
+    const hal_gamepad_builtin_mapping_t *builtin;
+    struct hal_gamepad_mapping_entry *next;
+} hal_gamepad_mapping_entry_t;
+
+/* GUID-keyed hash index over custom mappings and resolved devices */
+static hal_gamepad_mapping_entry_t **mapping_buckets = NULL;
+static unsigned int mapping_bucket_count = 0;
+static unsigned int mapping_entry_count = 0;
+
+/* Devices are resolved on backend threads (hotplug, reactor) while the
+   application adds mappings and reads bindings, so the index and the custom
+   bindings are only touched with this held */
+#ifdef HAL_GAMEPAD_MAPPING_LOCK
+static hal_lock_t mapping_lock = HAL_LOCK_INIT;
+#define MAPPING_LOCK() hal_lock_lock(&mapping_lock)
+#define MAPPING_UNLOCK() hal_lock_unlock(&mapping_lock)
+#else
+#define MAPPING_LOCK()
+#define MAPPING_UNLOCK()
+#endif
 
 /* Parse a single binding like "b0", "a1", "h0.1", "+a2", "-a3" */
 static void parse_binding(const char *binding, int *button_out, int *axis_out, int *hat_out, int *hat_mask, bool *inverted) {
@@ -97,18 +142,18 @@ static void parse_binding(const char *binding, int *button_out, int *axis_out, i
     }
 }
 
+/* Indices that do not fit the int8_t binding tables are treated as unmapped */
+static int8_t binding_index(int value) {
+    return (value >= 0 && value <= INT8_MAX) ? (int8_t)value : -1;
+}
+
 /* Parse an SDL mapping string and populate the mapping struct */
 static bool parse_mapping_string(const char *mapping_str, hal_gamepad_mapping_t *mapping) {
+    hal_gamepad_bindings_t *bindings = &mapping->bindings;
+
     /* Initialize all mappings to -1 (unmapped) */
-    for (int i = 0; i < HAL_GAMEPAD_BUTTON_MAX; i++) {
-        mapping->button_map[i] = -1;
-        mapping->axis_button_map[i] = -1;
-        mapping->axis_button_inverted[i] = false;
-    }
-    for (int i = 0; i < HAL_GAMEPAD_AXIS_MAX; i++)
-        mapping->axis_map[i] = -1;
-    for (int i = 0; i < 4; i++)
-        mapping->hat_map[i] = -1;
+    memset(bindings, 0xFF, sizeof(*bindings));
+    bindings->axis_button_inverted = 0;
     
     /* Parse GUID (first 32 chars) */
     if (strlen(mapping_str) < 33)
@@ -195,20 +240,23 @@ static bool parse_mapping_string(const char *mapping_str, hal_gamepad_mapping_t
         /* Store the mapping */
         if (btn != HAL_GAMEPAD_BUTTON_MAX) {
             if (button >= 0) {
-                mapping->button_map[btn] = button;
+                bindings->button_map[btn] = binding_index(button);
             } else if (axis >= 0) {
-                mapping->axis_button_map[btn] = axis;
-                mapping->axis_button_inverted[btn] = inverted;
+                bindings->axis_button_map[btn] = binding_index(axis);
+                if (inverted)
+                    bindings->axis_button_inverted |= (uint16_t)(1u << btn);
+                else
+                    bindings->axis_button_inverted &= (uint16_t)~(1u << btn);
             } else if (hat >= 0) {
                 /* D-pad from hat switch */
                 if (btn >= HAL_GAMEPAD_BUTTON_DPAD_UP && btn <= HAL_GAMEPAD_BUTTON_DPAD_RIGHT) {
-                    mapping->hat_map[btn - HAL_GAMEPAD_BUTTON_DPAD_UP] = hat_mask;
+                    bindings->hat_map[btn - HAL_GAMEPAD_BUTTON_DPAD_UP] = binding_index(hat_mask);
                 }
             }
         }
         
         if (ax != HAL_GAMEPAD_AXIS_MAX && axis >= 0) {
-            mapping->axis_map[ax] = axis;
+            bindings->axis_map[ax] = binding_index(axis);
         }
         
         /* Move to next pair */
@@ -229,77 +277,174 @@ static void generate_guid(hal_gamepad_device_t *device, char guid[33]) {
     );
 }
 
-/* Find mapping for a device */
-static hal_gamepad_mapping_t *find_mapping(hal_gamepad_device_t *device) {
-    char guid[33];
-    generate_guid(device, guid);
-    
-    /* Search custom mappings first */
-    for (unsigned int i = 0; i < custom_mapping_count; i++) {
-        if (strcmp(custom_mappings[i].guid, guid) == 0)
-            return &custom_mappings[i];
+/* Pack a 32 character hex GUID into 16 bytes, false if it is not hex */
+static bool pack_guid(const char *guid, uint8_t out[16]) {
+    for (int i = 0; i < 16; i++) {
+        int hi = (unsigned char)guid[i * 2], lo = (unsigned char)guid[i * 2 + 1];
+        if (!isxdigit(hi) || !isxdigit(lo))
+            return false;
+        hi = isdigit(hi) ? hi - '0' : tolower(hi) - 'a' + 10;
+        lo = isdigit(lo) ? lo - '0' : tolower(lo) - 'a' + 10;
+        out[i] = (uint8_t)(hi << 4 | lo);
     }
-    
-    /* Search builtin mappings */
-#if defined(HAL_PLATFORM_WINDOWS) || defined(HAL_PLATFORM_MACOS) || \
-    defined(HAL_PLATFORM_LINUX) || defined(HAL_PLATFORM_ANDROID) || defined(HAL_PLATFORM_IOS)
-    for (unsigned int i = 0; i < hal_gamepad_builtin_mapping_count; i++) {
-        if (strncmp(hal_gamepad_builtin_mappings[i], guid, 32) == 0) {
-            /* Found a match - parse and cache it */
-            static hal_gamepad_mapping_t cached;
-            static char cached_guid[33] = {0};
-            
-            if (strcmp(cached_guid, guid) != 0) {
-                if (cached.name) free(cached.name);
-                if (cached.mapping_string) free(cached.mapping_string);
-                memset(&cached, 0, sizeof(cached));
-                parse_mapping_string(hal_gamepad_builtin_mappings[i], &cached);
-                strncpy(cached_guid, guid, 32);
-            }
-            return &cached;
-        }
+    return true;
+}
+
+/* Binary search the generated table, which is sorted by packed GUID */
+static const hal_gamepad_builtin_mapping_t *find_builtin(const char *guid) {
+    uint8_t key[16];
+    if (!pack_guid(guid, key))
+        return NULL;
+
+    unsigned int lo = 0, hi = hal_gamepad_builtin_table_count;
+    while (lo < hi) {
+        unsigned int mid = lo + (hi - lo) / 2;
+        int cmp = memcmp(key, hal_gamepad_builtin_table[mid].guid, 16);
+        if (cmp == 0)
+            return &hal_gamepad_builtin_table[mid];
+        if (cmp < 0)
+            hi = mid;
+        else
+            lo = mid + 1;
     }
-#endif
-    
     return NULL;
 }
 
+/* FNV-1a over the 32 GUID characters */
+static unsigned int hash_guid(const char *guid) {
+    unsigned int hash = 2166136261u;
+    for (int i = 0; i < 32 && guid[i]; i++) {
+        hash ^= (unsigned char)guid[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static bool rehash_index(unsigned int bucket_count) {
+    hal_gamepad_mapping_entry_t **buckets = calloc(bucket_count, sizeof(hal_gamepad_mapping_entry_t *));
+    if (!buckets)
+        return false;
+    for (unsigned int i = 0; i < mapping_bucket_count; i++) {
+        hal_gamepad_mapping_entry_t *entry = mapping_buckets[i];
+        while (entry) {
+            hal_gamepad_mapping_entry_t *next = entry->next;
+            entry->next = buckets[entry->hash & (bucket_count - 1)];
+            buckets[entry->hash & (bucket_count - 1)] = entry;
+            entry = next;
+        }
+    }
+    free(mapping_buckets);
+    mapping_buckets = buckets;
+    mapping_bucket_count = bucket_count;
+    return true;
+}
+
+/* Find or create the index entry for a GUID, NULL if out of memory.
+   Call with mapping_lock held. */
+static hal_gamepad_mapping_entry_t *lookup_entry(const char *guid) {
+    unsigned int hash = hash_guid(guid);
+
+    if (mapping_bucket_count > 0) {
+        hal_gamepad_mapping_entry_t *entry = mapping_buckets[hash & (mapping_bucket_count - 1)];
+        for (; entry; entry = entry->next)
+            if (entry->hash == hash && strncmp(entry->guid, guid, 32) == 0)
+                return entry;
+    }
+
+    /* Keep the load factor at or below 1 */
+    if (mapping_entry_count + 1 > mapping_bucket_count &&
+        !rehash_index(mapping_bucket_count == 0 ? 64 : mapping_bucket_count * 2) &&
+        mapping_bucket_count == 0)
+        return NULL;
+
+    hal_gamepad_mapping_entry_t *entry = calloc(1, sizeof(hal_gamepad_mapping_entry_t));
+    if (!entry)
+        return NULL;
+    strncpy(entry->guid, guid, 32);
+    entry->guid[32] = '\0';
+    entry->hash = hash;
+    entry->builtin = find_builtin(guid);
+    entry->next = mapping_buckets[hash & (mapping_bucket_count - 1)];
+    mapping_buckets[hash & (mapping_bucket_count - 1)] = entry;
+    mapping_entry_count++;
+    return entry;
+}
+
+/* Resolve the active bindings for an index entry */
+static const hal_gamepad_bindings_t *entry_bindings(const hal_gamepad_mapping_entry_t *entry) {
+    if (!entry)
+        return NULL;
+    if (entry->custom)
+        return &entry->custom->bindings;
+    return entry->builtin ? &entry->builtin->bindings : NULL;
+}
+
+void hal_gamepad_mapping_init(void) {
+    MAPPING_LOCK();
+    if (mapping_bucket_count == 0)
+        rehash_index(64);
+    MAPPING_UNLOCK();
+}
+
+/* Devices without a mapping still get an entry so a later
+   hal_gamepad_add_mapping() for their GUID takes effect */
+static void resolve_mapping(hal_gamepad_device_t *device) {
+    char guid[33];
+    generate_guid(device, guid);
+    device->mapping = lookup_entry(guid);
+}
+
+void hal_gamepad_resolve_mapping(hal_gamepad_device_t *device) {
+    MAPPING_LOCK();
+    resolve_mapping(device);
+    MAPPING_UNLOCK();
+}
+
+/* Find mapping for a device, call with mapping_lock held */
+static hal_gamepad_mapping_entry_t *find_mapping(hal_gamepad_device_t *device) {
+    if (!device->mapping)
+        resolve_mapping(device);
+    return device->mapping;
+}
+
 /* Public API implementations */
 
 bool hal_gamepad_add_mapping(const char *mapping_string) {
     if (!mapping_string || strlen(mapping_string) < 34)
         return false;
-    
-    /* Grow array if needed */
-    if (custom_mapping_count >= custom_mapping_capacity) {
-        custom_mapping_capacity = custom_mapping_capacity == 0 ? 16 : custom_mapping_capacity * 2;
-        custom_mappings = realloc(custom_mappings, sizeof(hal_gamepad_mapping_t) * custom_mapping_capacity);
+
+    hal_gamepad_mapping_t *mapping = calloc(1, sizeof(hal_gamepad_mapping_t));
+    if (!mapping)
+        return false;
+    if (!parse_mapping_string(mapping_string, mapping)) {
+        free(mapping->name);
+        free(mapping->mapping_string);
+        free(mapping);
+        return false;
     }
-    
-    /* Check if we're updating an existing mapping */
-    char guid[33];
-    strncpy(guid, mapping_string, 32);
-    guid[32] = '\0';
-    
-    for (unsigned int i = 0; i < custom_mapping_count; i++) {
-        if (strcmp(custom_mappings[i].guid, guid) == 0) {
-            /* Update existing */
-            free(custom_mappings[i].name);
-            free(custom_mappings[i].mapping_string);
-            return parse_mapping_string(mapping_string, &custom_mappings[i]);
-        }
+
+    char *old_name = NULL, *old_string = NULL;
+    MAPPING_LOCK();
+    hal_gamepad_mapping_entry_t *entry = lookup_entry(mapping->guid);
+    if (entry && entry->custom) {
+        /* Update existing in place so attached devices see the change */
+        old_name = entry->custom->name;
+        old_string = entry->custom->mapping_string;
+        *entry->custom = *mapping;
+    } else if (entry) {
+        entry->custom = mapping;
+        mapping = NULL;
     }
-    
-    /* Add new mapping */
-    hal_gamepad_mapping_t *mapping = &custom_mappings[custom_mapping_count];
-    memset(mapping, 0, sizeof(*mapping));
-    
-    if (parse_mapping_string(mapping_string, mapping)) {
-        custom_mapping_count++;
-        return true;
+    MAPPING_UNLOCK();
+
+    if (!entry) {
+        free(mapping->name);
+        free(mapping->mapping_string);
     }
-    
-    return false;
+    free(mapping);
+    free(old_name);
+    free(old_string);
+    return entry != NULL;
 }
 
 int hal_gamepad_load_mappings(const char *filename) {
@@ -327,12 +472,10 @@ int hal_gamepad_load_mappings(const char *filename) {
     return count;
 }
 
-bool hal_gamepad_get_button(hal_gamepad_device_t *device, hal_gamepad_button_t button) {
-    if (!device || button >= HAL_GAMEPAD_BUTTON_MAX)
-        return false;
-    
-    hal_gamepad_mapping_t *mapping = find_mapping(device);
-    if (!mapping) {
+/* Read a button through the device's bindings, call with mapping_lock held */
+static bool mapped_button(hal_gamepad_device_t *device, hal_gamepad_button_t button) {
+    const hal_gamepad_bindings_t *bindings = entry_bindings(find_mapping(device));
+    if (!bindings) {
         /* No mapping - try direct index */
         if ((unsigned int)button < device->num_buttons)
             return device->button_states[button];
@@ -340,18 +483,18 @@ bool hal_gamepad_get_button(hal_gamepad_device_t *device, hal_gamepad_button_t b
     }
     
     /* Check button mapping */
-    if (mapping->button_map[button] >= 0) {
-        int idx = mapping->button_map[button];
+    if (bindings->button_map[button] >= 0) {
+        int idx = bindings->button_map[button];
         if ((unsigned int)idx < device->num_buttons)
             return device->button_states[idx];
     }
     
     /* Check axis-as-button mapping */
-    if (mapping->axis_button_map[button] >= 0) {
-        int idx = mapping->axis_button_map[button];
+    if (bindings->axis_button_map[button] >= 0) {
+        int idx = bindings->axis_button_map[button];
         if ((unsigned int)idx < device->num_axes) {
             float val = device->axis_states[idx];
-            if (mapping->axis_button_inverted[button])
+            if (bindings->axis_button_inverted & (1u << button))
                 return val < -0.5f;
             else
                 return val > 0.5f;
@@ -360,7 +503,7 @@ bool hal_gamepad_get_button(hal_gamepad_device_t *device, hal_gamepad_button_t b
     
     /* Check hat mapping for D-pad */
     if (button >= HAL_GAMEPAD_BUTTON_DPAD_UP && button <= HAL_GAMEPAD_BUTTON_DPAD_RIGHT) {
-        int hat_mask = mapping->hat_map[button - HAL_GAMEPAD_BUTTON_DPAD_UP];
+        int hat_mask = bindings->hat_map[button - HAL_GAMEPAD_BUTTON_DPAD_UP];
         if (hat_mask > 0) {
             /* Hat values are typically stored in axes with special encoding */
             /* This would need platform-specific handling */
@@ -370,20 +513,18 @@ bool hal_gamepad_get_button(hal_gamepad_device_t *device, hal_gamepad_button_t b
     return false;
 }
 
-float hal_gamepad_get_axis(hal_gamepad_device_t *device, hal_gamepad_axis_t axis) {
-    if (!device || axis >= HAL_GAMEPAD_AXIS_MAX)
-        return 0.0f;
-    
-    hal_gamepad_mapping_t *mapping = find_mapping(device);
-    if (!mapping) {
+/* Read an axis through the device's bindings, call with mapping_lock held */
+static float mapped_axis(hal_gamepad_device_t *device, hal_gamepad_axis_t axis) {
+    const hal_gamepad_bindings_t *bindings = entry_bindings(find_mapping(device));
+    if (!bindings) {
         /* No mapping - try direct index */
         if ((unsigned int)axis < device->num_axes)
             return device->axis_states[axis];
         return 0.0f;
     }
     
-    if (mapping->axis_map[axis] >= 0) {
-        int idx = mapping->axis_map[axis];
+    if (bindings->axis_map[axis] >= 0) {
+        int idx = bindings->axis_map[axis];
         if ((unsigned int)idx < device->num_axes)
             return device->axis_states[idx];
     }
@@ -391,16 +532,57 @@ float hal_gamepad_get_axis(hal_gamepad_device_t *device, hal_gamepad_axis_t axis
     return 0.0f;
 }
 
+bool hal_gamepad_get_button(hal_gamepad_device_t *device, hal_gamepad_button_t button) {
+    if (!device || button >= HAL_GAMEPAD_BUTTON_MAX)
+        return false;
+    MAPPING_LOCK();
+    bool result = mapped_button(device, button);
+    MAPPING_UNLOCK();
+    return result;
+}
+
+float hal_gamepad_get_axis(hal_gamepad_device_t *device, hal_gamepad_axis_t axis) {
+    if (!device || axis >= HAL_GAMEPAD_AXIS_MAX)
+        return 0.0f;
+    MAPPING_LOCK();
+    float result = mapped_axis(device, axis);
+    MAPPING_UNLOCK();
+    return result;
+}
+
+void hal_gamepad_fill_snapshot(hal_gamepad_device_t *device, hal_gamepad_snapshot_t *snapshot) {
+    snapshot->buttons = 0;
+    MAPPING_LOCK();
+    for (int button = 0; button < HAL_GAMEPAD_BUTTON_MAX; button++)
+        if (mapped_button(device, (hal_gamepad_button_t)button))
+            snapshot->buttons |= 1u << button;
+    for (int axis = 0; axis < HAL_GAMEPAD_AXIS_MAX; axis++)
+        snapshot->axes[axis] = mapped_axis(device, (hal_gamepad_axis_t)axis);
+    MAPPING_UNLOCK();
+}
+
 bool hal_gamepad_is_mapped(hal_gamepad_device_t *device) {
-    return device && find_mapping(device) != NULL;
+    if (!device)
+        return false;
+    MAPPING_LOCK();
+    bool result = entry_bindings(find_mapping(device)) != NULL;
+    MAPPING_UNLOCK();
+    return result;
 }
 
 const char *hal_gamepad_get_mapping(hal_gamepad_device_t *device) {
     if (!device)
         return NULL;
-    
-    hal_gamepad_mapping_t *mapping = find_mapping(device);
-    return mapping ? mapping->mapping_string : NULL;
+
+    const char *result = NULL;
+    MAPPING_LOCK();
+    const hal_gamepad_mapping_entry_t *entry = find_mapping(device);
+    if (entry && entry->custom)
+        result = entry->custom->mapping_string;
+    else if (entry && entry->builtin)
+        result = hal_gamepad_builtin_mappings[entry->builtin->string_index];
+    MAPPING_UNLOCK();
+    return result;
 }
 
 #endif /* HAL_NO_GAMEPAD */
@@ -38,6 +38,15 @@ static hal_gamepad_device_t *device_for_controller(GCController *controller) {
     return NULL;
 }
 
+static void report_axis(hal_gamepad_device_t *device, unsigned int axis_id, float value, double ts) {
+    float last_value = device->axis_states[axis_id];
+    if (!hal_gamepad_filter_axis(device, axis_id, &value))
+        return;
+    device->axis_states[axis_id] = value;
+    if (hal_gamepad_axis_cb)
+        hal_gamepad_axis_cb(device, axis_id, value, last_value, ts, hal_gamepad_axis_ctx);
+}
+
 static void setup_handlers(hal_gamepad_device_t *device) {
     hal_gamepad_private_t *priv = device->private_data;
     GCController *controller = priv->controller;
@@ -90,40 +99,24 @@ static void setup_handlers(hal_gamepad_device_t *device) {
         /* Axis handlers */
         gamepad.leftThumbstick.valueChangedHandler = ^(GCControllerDirectionPad *dpad, float xValue, float yValue) {
             double ts = [[NSProcessInfo processInfo] systemUptime];
-            if (hal_gamepad_axis_cb) {
-                if (xValue != device->axis_states[0])
-                    hal_gamepad_axis_cb(device, 0, xValue, device->axis_states[0], ts, hal_gamepad_axis_ctx);
-                if (yValue != device->axis_states[1])
-                    hal_gamepad_axis_cb(device, 1, yValue, device->axis_states[1], ts, hal_gamepad_axis_ctx);
-            }
-            device->axis_states[0] = xValue;
-            device->axis_states[1] = yValue;
+            report_axis(device, 0, xValue, ts);
+            report_axis(device, 1, yValue, ts);
         };
         
         gamepad.rightThumbstick.valueChangedHandler = ^(GCControllerDirectionPad *dpad, float xValue, float yValue) {
             double ts = [[NSProcessInfo processInfo] systemUptime];
-            if (hal_gamepad_axis_cb) {
-                if (xValue != device->axis_states[2])
-                    hal_gamepad_axis_cb(device, 2, xValue, device->axis_states[2], ts, hal_gamepad_axis_ctx);
-                if (yValue != device->axis_states[3])
-                    hal_gamepad_axis_cb(device, 3, yValue, device->axis_states[3], ts, hal_gamepad_axis_ctx);
-            }
-            device->axis_states[2] = xValue;
-            device->axis_states[3] = yValue;
+            report_axis(device, 2, xValue, ts);
+            report_axis(device, 3, yValue, ts);
         };
         
         gamepad.leftTrigger.valueChangedHandler = ^(GCControllerButtonInput *button, float value, BOOL pressed) {
             double ts = [[NSProcessInfo processInfo] systemUptime];
-            if (hal_gamepad_axis_cb && value != device->axis_states[4])
-                hal_gamepad_axis_cb(device, 4, value, device->axis_states[4], ts, hal_gamepad_axis_ctx);
-            device->axis_states[4] = value;
+            report_axis(device, 4, value, ts);
         };
         
         gamepad.rightTrigger.valueChangedHandler = ^(GCControllerButtonInput *button, float value, BOOL pressed) {
             double ts = [[NSProcessInfo processInfo] systemUptime];
-            if (hal_gamepad_axis_cb && value != device->axis_states[5])
-                hal_gamepad_axis_cb(device, 5, value, device->axis_states[5], ts, hal_gamepad_axis_ctx);
-            device->axis_states[5] = value;
+            report_axis(device, 5, value, ts);
         };
     }
 }
@@ -143,10 +136,12 @@ static void on_controller_connected(NSNotification *notification) {
     device->num_buttons = 16;
     device->axis_states = calloc(sizeof(float), device->num_axes);
     device->button_states = calloc(sizeof(bool), device->num_buttons);
+    device->axis_filters = NULL;
     
     hal_gamepad_private_t *priv = malloc(sizeof(hal_gamepad_private_t));
     priv->controller = controller;
     device->private_data = priv;
+    hal_gamepad_resolve_mapping(device);
     
     devices = realloc(devices, sizeof(hal_gamepad_device_t *) * (num_devices + 1));
     devices[num_devices++] = device;
@@ -179,6 +174,7 @@ static void on_controller_disconnected(NSNotification *notification) {
     hal_gamepad_private_t *priv = device->private_data;
     free(priv);
     free(device->axis_states);
+    free(device->axis_filters);
     free(device->button_states);
     free(device);
 }
@@ -205,6 +201,7 @@ void hal_gamepad_init(void) {
                                                       on_controller_disconnected(note);
                                                   }];
     
+    hal_gamepad_mapping_init();
     inited = true;
     hal_gamepad_detect_devices();
 }
@@ -258,4 +255,30 @@ void hal_gamepad_process_events(void) {
     /* Events are delivered via notification handlers set up in init */
 }
 
+int hal_gamepad_poll(int timeout_ms) {
+    (void)timeout_ms;
+    return 0;
+}
+
+bool hal_gamepad_get_snapshot(hal_gamepad_device_t *device, hal_gamepad_snapshot_t *snapshot) {
+    /* State is only updated on the thread that processes events */
+    if (!device || !snapshot)
+        return false;
+    hal_gamepad_fill_snapshot(device, snapshot);
+    return true;
+}
+
+size_t hal_gamepad_drain_events(hal_gamepad_event_t *out, size_t max) {
+    /* Input is delivered through callbacks as it arrives */
+    (void)out;
+    (void)max;
+    return 0;
+}
+
+unsigned long long hal_gamepad_dropped_events(hal_gamepad_device_t *device) {
+    /* Events are not held in a bounded queue on this platform */
+    (void)device;
+    return 0;
+}
+
 #endif /* HAL_NO_GAMEPAD */
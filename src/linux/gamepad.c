@@ -24,20 +24,51 @@
 #include <linux/input.h>
 #define __USE_UNIX98
 #include <pthread.h>
+#include <stdatomic.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
 #include <sys/ioctl.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #include <time.h>
 
+/* Single-producer/single-consumer event queue. The device thread is the only
+   producer; hal_gamepad_process_events is the only consumer. tail is advanced
+   with CAS so the producer can also drop the oldest event when full. */
+typedef struct {
+    atomic_size_t head;
+    char head_pad[64 - sizeof(atomic_size_t)];
+    atomic_size_t tail;
+    char tail_pad[64 - sizeof(atomic_size_t)];
+    atomic_ullong dropped;
+    size_t mask;
+    hal_gamepad_overflow_t policy;
+    hal_gamepad_event_t *events;
+    /* Producer-only state for HAL_GAMEPAD_OVERFLOW_COALESCE */
+    hal_gamepad_event_t *pending_axes;
+    bool *pending_dirty;
+    unsigned int pending_count;
+} hal_gamepad_event_ring_t;
+
+#define HAL_GAMEPAD_READ_BATCH 64
+
 typedef struct {
     pthread_t thread;
+    bool has_thread;
     int fd;
     char *path;
     int button_map[KEY_CNT - BTN_MISC];
     int axis_map[ABS_CNT];
     struct input_absinfo axis_info[ABS_CNT];
+    hal_gamepad_event_ring_t ring;
+    /* Seqlock over axis_states/button_states: odd while the reader thread writes */
+    atomic_uint state_sequence;
+    /* Consumer-only: latest axis event per axis within one process_events pass */
+    hal_gamepad_event_t *latest_axes;
+    bool *latest_dirty;
 } hal_gamepad_private_t;
 
 static hal_gamepad_device_t **devices = NULL;
@@ -46,97 +77,224 @@ static unsigned int next_device_id = 0;
 static time_t last_input_stat_time = 0;
 static pthread_mutex_t devices_mutex;
 
-static hal_gamepad_queued_event_t *event_queue = NULL;
-static size_t event_queue_size = 0;
-static size_t event_count = 0;
-static pthread_mutex_t event_queue_mutex;
+/* Devices whose reader thread has exited, waiting for their remaining
+   events and removal callback in hal_gamepad_process_events */
+static hal_gamepad_device_t **removed_devices = NULL;
+static unsigned int num_removed_devices = 0;
+
+/* Devices attached by hotplug, announced from hal_gamepad_process_events */
+static hal_gamepad_device_t **attached_devices = NULL;
+static unsigned int num_attached_devices = 0;
+
+/* Devices reported as removed by hal_gamepad_drain_events, disposed on its next call */
+static hal_gamepad_device_t **retired_devices = NULL;
+static unsigned int num_retired_devices = 0;
 
 static bool inited = false;
 
+/* Reactor state for HAL_GAMEPAD_IO_REACTOR_THREAD and HAL_GAMEPAD_IO_MANUAL */
+static hal_gamepad_io_mode_t io_mode = HAL_GAMEPAD_IO_THREAD_PER_DEVICE;
+static int epoll_fd = -1;
+static int wake_fd = -1;
+static pthread_t reactor_thread;
+static bool has_reactor_thread = false;
+
+/* inotify watch on /dev/input, registered in the epoll set under &hotplug_fd */
+static int hotplug_fd = -1;
+
+static void hotplug_read(void);
+
 #define test_bit(bit_index, array) \
     ((array[(bit_index) / (sizeof(int) * 8)] >> ((bit_index) % (sizeof(int) * 8))) & 0x1)
 
-static void queue_event(unsigned int device_id, hal_gamepad_event_type_t event_type, void *event_data) {
-    hal_gamepad_queued_event_t event;
-    event.device_id = device_id;
-    event.event_type = event_type;
-    event.event_data = event_data;
+static void ring_init(hal_gamepad_event_ring_t *ring, unsigned int num_axes) {
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    atomic_init(&ring->dropped, 0);
+    ring->mask = hal_gamepad_queue_capacity - 1;
+    ring->policy = hal_gamepad_queue_policy;
+    ring->events = malloc(sizeof(hal_gamepad_event_t) * hal_gamepad_queue_capacity);
+    ring->pending_axes = calloc(num_axes ? num_axes : 1, sizeof(hal_gamepad_event_t));
+    ring->pending_dirty = calloc(num_axes ? num_axes : 1, sizeof(bool));
+    ring->pending_count = 0;
+}
+
+static void ring_free(hal_gamepad_event_ring_t *ring) {
+    free(ring->events);
+    free(ring->pending_axes);
+    free(ring->pending_dirty);
+}
 
-    pthread_mutex_lock(&event_queue_mutex);
-    if (event_count >= event_queue_size) {
-        event_queue_size = event_queue_size == 0 ? 1 : event_queue_size * 2;
-        event_queue = realloc(event_queue, sizeof(hal_gamepad_queued_event_t) * event_queue_size);
+static bool ring_push(hal_gamepad_event_ring_t *ring, const hal_gamepad_event_t *event) {
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    while (head - tail > ring->mask) {
+        if (ring->policy != HAL_GAMEPAD_OVERFLOW_DROP_OLDEST)
+            return false;
+        /* Full - discard the oldest event unless the consumer just took it */
+        if (atomic_compare_exchange_weak_explicit(&ring->tail, &tail, tail + 1,
+                                                  memory_order_acq_rel, memory_order_acquire)) {
+            atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+            break;
+        }
+    }
+    ring->events[head & ring->mask] = *event;
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    return true;
+}
+
+static bool ring_pop(hal_gamepad_event_ring_t *ring, hal_gamepad_event_t *event) {
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    for (;;) {
+        size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        if (tail == head)
+            return false;
+        *event = ring->events[tail & ring->mask];
+        /* If the producer dropped (and possibly overwrote) this slot while it
+           was being copied, the CAS fails and the copy is discarded */
+        if (atomic_compare_exchange_weak_explicit(&ring->tail, &tail, tail + 1,
+                                                  memory_order_acq_rel, memory_order_acquire))
+            return true;
+    }
+}
+
+/* Publish held-back axis events while there is room (coalesce policy only) */
+static void ring_flush_pending(hal_gamepad_event_ring_t *ring, unsigned int num_axes) {
+    for (unsigned int i = 0; i < num_axes && ring->pending_count > 0; i++) {
+        if (!ring->pending_dirty[i])
+            continue;
+        if (!ring_push(ring, &ring->pending_axes[i]))
+            return;
+        ring->pending_dirty[i] = false;
+        ring->pending_count--;
+    }
+}
+
+static void queue_device_event(hal_gamepad_device_t *device, const hal_gamepad_event_t *event) {
+    hal_gamepad_private_t *priv = device->private_data;
+    hal_gamepad_event_ring_t *ring = &priv->ring;
+
+    if (ring->pending_count > 0)
+        ring_flush_pending(ring, device->num_axes);
+    /* Keep per-axis ordering: a newer sample must not overtake a held-back one */
+    if (event->event_type == HAL_GAMEPAD_EVENT_AXIS_MOVED &&
+        ring->pending_dirty[event->axis.axis_id]) {
+        hal_gamepad_event_t *pending = &ring->pending_axes[event->axis.axis_id];
+        pending->timestamp = event->timestamp;
+        pending->axis.value = event->axis.value;
+        atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+        return;
     }
-    event_queue[event_count++] = event;
-    pthread_mutex_unlock(&event_queue_mutex);
+    if (ring_push(ring, event))
+        return;
+
+    if (event->event_type == HAL_GAMEPAD_EVENT_AXIS_MOVED) {
+        ring->pending_axes[event->axis.axis_id] = *event;
+        ring->pending_dirty[event->axis.axis_id] = true;
+        ring->pending_count++;
+    } else
+        atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
 }
 
 static void queue_axis_event(hal_gamepad_device_t *device, double timestamp, unsigned int axis_id, float value, float last_value) {
-    hal_gamepad_axis_event_t *event = malloc(sizeof(hal_gamepad_axis_event_t));
-    event->device = device;
-    event->timestamp = timestamp;
-    event->axis_id = axis_id;
-    event->value = value;
-    event->last_value = last_value;
-    queue_event(device->device_id, HAL_GAMEPAD_EVENT_AXIS_MOVED, event);
+    hal_gamepad_event_t event;
+    event.event_type = HAL_GAMEPAD_EVENT_AXIS_MOVED;
+    event.device = device;
+    event.timestamp = timestamp;
+    event.axis.axis_id = axis_id;
+    event.axis.value = value;
+    event.axis.last_value = last_value;
+    queue_device_event(device, &event);
 }
 
 static void queue_button_event(hal_gamepad_device_t *device, double timestamp, unsigned int button_id, bool down) {
-    hal_gamepad_button_event_t *event = malloc(sizeof(hal_gamepad_button_event_t));
-    event->device = device;
-    event->timestamp = timestamp;
-    event->button_id = button_id;
-    event->down = down;
-    queue_event(device->device_id, down ? HAL_GAMEPAD_EVENT_BUTTON_DOWN : HAL_GAMEPAD_EVENT_BUTTON_UP, event);
+    hal_gamepad_event_t event;
+    event.event_type = down ? HAL_GAMEPAD_EVENT_BUTTON_DOWN : HAL_GAMEPAD_EVENT_BUTTON_UP;
+    event.device = device;
+    event.timestamp = timestamp;
+    event.button.button_id = button_id;
+    queue_device_event(device, &event);
 }
 
 static void dispose_device(hal_gamepad_device_t *device) {
     hal_gamepad_private_t *priv = device->private_data;
     close(priv->fd);
     free(priv->path);
+    ring_free(&priv->ring);
+    free(priv->latest_axes);
+    free(priv->latest_dirty);
     free(priv);
     free((void *)device->description);
     free(device->axis_states);
+    free(device->axis_filters);
     free(device->button_states);
     free(device);
 }
 
-static void *device_thread(void *context) {
-    hal_gamepad_device_t *device = context;
-    hal_gamepad_private_t *priv = device->private_data;
-    struct input_event event;
-
-    while (read(priv->fd, &event, sizeof(struct input_event)) > 0) {
-        if (event.type == EV_ABS) {
-            if (event.code > ABS_MAX || priv->axis_map[event.code] == -1)
-                continue;
-
-            float value = (event.value - priv->axis_info[event.code].minimum) /
-                (float)(priv->axis_info[event.code].maximum - priv->axis_info[event.code].minimum) * 2.0f - 1.0f;
-
-            queue_axis_event(device,
-                event.time.tv_sec + event.time.tv_usec * 0.000001,
-                priv->axis_map[event.code],
-                value,
-                device->axis_states[priv->axis_map[event.code]]);
-
-            device->axis_states[priv->axis_map[event.code]] = value;
+static void state_write_begin(hal_gamepad_private_t *priv) {
+    unsigned int sequence = atomic_load_explicit(&priv->state_sequence, memory_order_relaxed);
+    atomic_store_explicit(&priv->state_sequence, sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+}
 
-        } else if (event.type == EV_KEY) {
-            if (event.code < BTN_MISC || event.code > KEY_MAX || priv->button_map[event.code - BTN_MISC] == -1)
-                continue;
+static void state_write_end(hal_gamepad_private_t *priv) {
+    unsigned int sequence = atomic_load_explicit(&priv->state_sequence, memory_order_relaxed);
+    atomic_store_explicit(&priv->state_sequence, sequence + 1, memory_order_release);
+}
 
-            queue_button_event(device,
-                event.time.tv_sec + event.time.tv_usec * 0.000001,
-                priv->button_map[event.code - BTN_MISC],
-                !!event.value);
+static void handle_input_event(hal_gamepad_device_t *device, const struct input_event *event) {
+    hal_gamepad_private_t *priv = device->private_data;
 
-            device->button_states[priv->button_map[event.code - BTN_MISC]] = !!event.value;
-        }
+    if (event->type == EV_ABS) {
+        if (event->code > ABS_MAX || priv->axis_map[event->code] == -1)
+            return;
+
+        float value = (event->value - priv->axis_info[event->code].minimum) /
+            (float)(priv->axis_info[event->code].maximum - priv->axis_info[event->code].minimum) * 2.0f - 1.0f;
+        if (!hal_gamepad_filter_axis(device, priv->axis_map[event->code], &value))
+            return;
+
+        queue_axis_event(device,
+            event->time.tv_sec + event->time.tv_usec * 0.000001,
+            priv->axis_map[event->code],
+            value,
+            device->axis_states[priv->axis_map[event->code]]);
+
+        state_write_begin(priv);
+        device->axis_states[priv->axis_map[event->code]] = value;
+        state_write_end(priv);
+
+    } else if (event->type == EV_KEY) {
+        if (event->code < BTN_MISC || event->code > KEY_MAX || priv->button_map[event->code - BTN_MISC] == -1)
+            return;
+
+        queue_button_event(device,
+            event->time.tv_sec + event->time.tv_usec * 0.000001,
+            priv->button_map[event->code - BTN_MISC],
+            !!event->value);
+
+        state_write_begin(priv);
+        device->button_states[priv->button_map[event->code - BTN_MISC]] = !!event->value;
+        state_write_end(priv);
     }
+}
 
-    queue_event(device->device_id, HAL_GAMEPAD_EVENT_REMOVED, device);
+/* Read one batch of input, returns the number of events or <= 0 like read() */
+static ssize_t read_input_batch(hal_gamepad_device_t *device) {
+    hal_gamepad_private_t *priv = device->private_data;
+    struct input_event events[HAL_GAMEPAD_READ_BATCH];
+
+    ssize_t bytes = read(priv->fd, events, sizeof(events));
+    if (bytes <= 0)
+        return bytes;
+    ssize_t count = bytes / (ssize_t)sizeof(struct input_event);
+    for (ssize_t i = 0; i < count; i++)
+        handle_input_event(device, &events[i]);
+    return count;
+}
 
+/* Move a device whose input has ended to the removed list */
+static void remove_device(hal_gamepad_device_t *device) {
     pthread_mutex_lock(&devices_mutex);
     for (unsigned int i = 0; i < num_devices; i++) {
         if (devices[i] == device) {
@@ -146,11 +304,115 @@ static void *device_thread(void *context) {
             break;
         }
     }
+    removed_devices = realloc(removed_devices, sizeof(hal_gamepad_device_t *) * (num_removed_devices + 1));
+    removed_devices[num_removed_devices++] = device;
     pthread_mutex_unlock(&devices_mutex);
+}
+
+static void *device_thread(void *context) {
+    hal_gamepad_device_t *device = context;
+
+    while (read_input_batch(device) > 0)
+        ;
+
+    remove_device(device);
+    return NULL;
+}
+
+/* Wait for and read input on all devices, returns events read or -1 to stop */
+static int reactor_wait(int timeout_ms) {
+    struct epoll_event ready[16];
+    int total = 0;
+
+    int count = epoll_wait(epoll_fd, ready, 16, timeout_ms);
+    if (count < 0)
+        return errno == EINTR ? 0 : -1;
+
+    for (int i = 0; i < count; i++) {
+        hal_gamepad_device_t *device = ready[i].data.ptr;
+        if (device == NULL) {
+            /* Shutdown requested through the eventfd */
+            uint64_t value;
+            (void)!read(wake_fd, &value, sizeof(value));
+            return -1;
+        }
+        if (ready[i].data.ptr == &hotplug_fd) {
+            hotplug_read();
+            continue;
+        }
 
+        hal_gamepad_private_t *priv = device->private_data;
+        ssize_t n;
+        /* Drain everything that is ready, HAL_GAMEPAD_READ_BATCH events per syscall */
+        while ((n = read_input_batch(device)) > 0)
+            total += (int)n;
+        if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+            epoll_ctl(epoll_fd, EPOLL_CTL_DEL, priv->fd, NULL);
+            remove_device(device);
+        }
+    }
+    return total;
+}
+
+static void *reactor_thread_main(void *context) {
+    (void)context;
+    while (reactor_wait(-1) >= 0)
+        ;
     return NULL;
 }
 
+static bool reactor_open(void) {
+    struct epoll_event ev;
+
+    epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (epoll_fd < 0 || wake_fd < 0)
+        return false;
+
+    ev.events = EPOLLIN;
+    ev.data.ptr = NULL;
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wake_fd, &ev) != 0)
+        return false;
+
+    /* Hotplug is optional; without it hal_gamepad_detect_devices still works */
+    hotplug_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (hotplug_fd >= 0) {
+        ev.data.ptr = &hotplug_fd;
+        if (inotify_add_watch(hotplug_fd, "/dev/input", IN_CREATE | IN_ATTRIB | IN_MOVED_TO) < 0 ||
+            epoll_ctl(epoll_fd, EPOLL_CTL_ADD, hotplug_fd, &ev) != 0) {
+            close(hotplug_fd);
+            hotplug_fd = -1;
+        }
+    }
+    return true;
+}
+
+static void reactor_close(void) {
+    if (hotplug_fd >= 0)
+        close(hotplug_fd);
+    hotplug_fd = -1;
+    if (wake_fd >= 0)
+        close(wake_fd);
+    if (epoll_fd >= 0)
+        close(epoll_fd);
+    wake_fd = epoll_fd = -1;
+}
+
+/* Start reading input for a newly attached device */
+static void start_device(hal_gamepad_device_t *device) {
+    hal_gamepad_private_t *priv = device->private_data;
+
+    if (io_mode == HAL_GAMEPAD_IO_THREAD_PER_DEVICE) {
+        priv->has_thread = pthread_create(&priv->thread, NULL, device_thread, device) == 0;
+    } else {
+        struct epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.ptr = device;
+        fcntl(priv->fd, F_SETFL, fcntl(priv->fd, F_GETFL) | O_NONBLOCK);
+        epoll_ctl(epoll_fd, EPOLL_CTL_ADD, priv->fd, &ev);
+    }
+}
+
 bool hal_gamepad_available(void) {
     return true;
 }
@@ -161,9 +423,25 @@ void hal_gamepad_init(void) {
         pthread_mutexattr_init(&recursive_lock);
         pthread_mutexattr_settype(&recursive_lock, PTHREAD_MUTEX_RECURSIVE);
         pthread_mutex_init(&devices_mutex, &recursive_lock);
-        pthread_mutex_init(&event_queue_mutex, &recursive_lock);
+        hal_gamepad_mapping_init();
+
+        /* The epoll set is also used for hotplug, so it is opened in every mode */
+        io_mode = hal_gamepad_io_mode;
+        if (!reactor_open()) {
+            reactor_close();
+            io_mode = HAL_GAMEPAD_IO_THREAD_PER_DEVICE;
+        }
+
         inited = true;
         hal_gamepad_detect_devices();
+
+        /* With thread-per-device reading, the reactor thread only waits for hotplug */
+        if (io_mode == HAL_GAMEPAD_IO_REACTOR_THREAD ||
+            (io_mode == HAL_GAMEPAD_IO_THREAD_PER_DEVICE && hotplug_fd >= 0)) {
+            has_reactor_thread = pthread_create(&reactor_thread, NULL, reactor_thread_main, NULL) == 0;
+            if (!has_reactor_thread && io_mode == HAL_GAMEPAD_IO_REACTOR_THREAD)
+                io_mode = HAL_GAMEPAD_IO_MANUAL;
+        }
     }
 }
 
@@ -171,13 +449,22 @@ void hal_gamepad_shutdown(void) {
     if (inited) {
         unsigned int devices_left;
 
+        if (has_reactor_thread) {
+            uint64_t one = 1;
+            (void)!write(wake_fd, &one, sizeof(one));
+            pthread_join(reactor_thread, NULL);
+            has_reactor_thread = false;
+        }
+
         do {
             pthread_mutex_lock(&devices_mutex);
             devices_left = num_devices;
             if (devices_left > 0) {
                 hal_gamepad_private_t *priv = devices[0]->private_data;
-                pthread_cancel(priv->thread);
-                pthread_join(priv->thread, NULL);
+                if (priv->has_thread) {
+                    pthread_cancel(priv->thread);
+                    pthread_join(priv->thread, NULL);
+                }
                 dispose_device(devices[0]);
                 num_devices--;
                 for (unsigned int i = 0; i < num_devices; i++)
@@ -186,23 +473,29 @@ void hal_gamepad_shutdown(void) {
             pthread_mutex_unlock(&devices_mutex);
         } while (devices_left > 0);
 
+        for (unsigned int i = 0; i < num_removed_devices; i++) {
+            hal_gamepad_private_t *priv = removed_devices[i]->private_data;
+            if (priv->has_thread)
+                pthread_join(priv->thread, NULL);
+            dispose_device(removed_devices[i]);
+        }
+        for (unsigned int i = 0; i < num_retired_devices; i++)
+            dispose_device(retired_devices[i]);
+        reactor_close();
+
         pthread_mutex_destroy(&devices_mutex);
-        pthread_mutex_destroy(&event_queue_mutex);
         free(devices);
         devices = NULL;
+        free(removed_devices);
+        removed_devices = NULL;
+        num_removed_devices = 0;
+        free(attached_devices);
+        attached_devices = NULL;
+        num_attached_devices = 0;
+        free(retired_devices);
+        retired_devices = NULL;
+        num_retired_devices = 0;
         last_input_stat_time = 0;
-
-        for (size_t i = 0; i < event_count; i++) {
-            if (event_queue[i].event_type == HAL_GAMEPAD_EVENT_REMOVED)
-                dispose_device(event_queue[i].event_data);
-            else if (event_queue[i].event_type != HAL_GAMEPAD_EVENT_ATTACHED)
-                free(event_queue[i].event_data);
-        }
-
-        event_queue_size = 0;
-        event_count = 0;
-        free(event_queue);
-        event_queue = NULL;
         inited = false;
     }
 }
@@ -223,131 +516,154 @@ hal_gamepad_device_t *hal_gamepad_device_at(unsigned int index) {
     return result;
 }
 
-void hal_gamepad_detect_devices(void) {
-    struct input_id id;
-    DIR *dev_input;
-    struct dirent *entity;
-    unsigned int chars_consumed;
+static bool is_known_device(const char *file_name) {
+    for (unsigned int i = 0; i < num_devices; i++) {
+        hal_gamepad_private_t *priv = devices[i]->private_data;
+        if (!strcmp(priv->path, file_name))
+            return true;
+    }
+    return false;
+}
+
+static bool is_event_node(const char *name) {
+    unsigned int chars_consumed = 0;
     int num;
+    return sscanf(name, "event%d%n", &num, &chars_consumed) && chars_consumed == strlen(name);
+}
+
+/* Open and start a device if it is a gamepad, devices_mutex must be held */
+static hal_gamepad_device_t *open_device(const char *file_name) {
+    struct input_id id;
     int fd;
     int ev_cap_bits[(EV_CNT - 1) / sizeof(int) / 8 + 1];
     int ev_key_bits[(KEY_CNT - 1) / sizeof(int) / 8 + 1];
     int ev_abs_bits[(ABS_CNT - 1) / sizeof(int) / 8 + 1];
-    char file_name[PATH_MAX];
-    bool duplicate;
-    struct stat stat_buf;
     char name[128];
     char *description;
-    time_t current_time;
 
-    if (!inited)
-        return;
+    fd = open(file_name, O_RDONLY | O_CLOEXEC, 0);
+    if (fd < 0)
+        return NULL;
+
+    memset(ev_cap_bits, 0, sizeof(ev_cap_bits));
+    memset(ev_key_bits, 0, sizeof(ev_key_bits));
+    memset(ev_abs_bits, 0, sizeof(ev_abs_bits));
+    if (ioctl(fd, EVIOCGBIT(0, sizeof(ev_cap_bits)), ev_cap_bits) < 0 ||
+        ioctl(fd, EVIOCGBIT(EV_KEY, sizeof(ev_key_bits)), ev_key_bits) < 0 ||
+        ioctl(fd, EVIOCGBIT(EV_ABS, sizeof(ev_abs_bits)), ev_abs_bits) < 0) {
+        close(fd);
+        return NULL;
+    }
 
-    pthread_mutex_lock(&devices_mutex);
+    if (!test_bit(EV_KEY, ev_cap_bits) || !test_bit(EV_ABS, ev_cap_bits) ||
+        !test_bit(ABS_X, ev_abs_bits) || !test_bit(ABS_Y, ev_abs_bits) ||
+        (!test_bit(BTN_TRIGGER, ev_key_bits) && !test_bit(BTN_A, ev_key_bits) && !test_bit(BTN_1, ev_key_bits))) {
+        close(fd);
+        return NULL;
+    }
 
-    dev_input = opendir("/dev/input");
-    current_time = time(NULL);
-    if (dev_input != NULL) {
-        while ((entity = readdir(dev_input)) != NULL) {
-            chars_consumed = 0;
-            if (sscanf(entity->d_name, "event%d%n", &num, &chars_consumed) && chars_consumed == strlen(entity->d_name)) {
-                snprintf(file_name, PATH_MAX, "/dev/input/%s", entity->d_name);
-                if (stat(file_name, &stat_buf) || stat_buf.st_mtime < last_input_stat_time)
-                    continue;
-
-                duplicate = false;
-                for (unsigned int i = 0; i < num_devices; i++) {
-                    hal_gamepad_private_t *priv = devices[i]->private_data;
-                    if (!strcmp(priv->path, file_name)) {
-                        duplicate = true;
-                        break;
-                    }
-                }
-                if (duplicate)
-                    continue;
-
-                fd = open(file_name, O_RDONLY, 0);
-                if (fd < 0)
-                    continue;
-
-                memset(ev_cap_bits, 0, sizeof(ev_cap_bits));
-                memset(ev_key_bits, 0, sizeof(ev_key_bits));
-                memset(ev_abs_bits, 0, sizeof(ev_abs_bits));
-                if (ioctl(fd, EVIOCGBIT(0, sizeof(ev_cap_bits)), ev_cap_bits) < 0 ||
-                    ioctl(fd, EVIOCGBIT(EV_KEY, sizeof(ev_key_bits)), ev_key_bits) < 0 ||
-                    ioctl(fd, EVIOCGBIT(EV_ABS, sizeof(ev_abs_bits)), ev_abs_bits) < 0) {
-                    close(fd);
-                    continue;
-                }
+    hal_gamepad_device_t *device = malloc(sizeof(hal_gamepad_device_t));
+    device->device_id = next_device_id++;
+    devices = realloc(devices, sizeof(hal_gamepad_device_t *) * (num_devices + 1));
+    devices[num_devices++] = device;
+
+    hal_gamepad_private_t *priv = malloc(sizeof(hal_gamepad_private_t));
+    priv->fd = fd;
+    priv->has_thread = false;
+    priv->path = malloc(strlen(file_name) + 1);
+    strcpy(priv->path, file_name);
+    memset(priv->button_map, 0xFF, sizeof(priv->button_map));
+    memset(priv->axis_map, 0xFF, sizeof(priv->axis_map));
+    device->private_data = priv;
+
+    if (ioctl(fd, EVIOCGNAME(sizeof(name)), name) > 0) {
+        description = malloc(strlen(name) + 1);
+        strcpy(description, name);
+    } else {
+        description = malloc(strlen(file_name) + 1);
+        strcpy(description, file_name);
+    }
+    device->description = description;
 
-                if (!test_bit(EV_KEY, ev_cap_bits) || !test_bit(EV_ABS, ev_cap_bits) ||
-                    !test_bit(ABS_X, ev_abs_bits) || !test_bit(ABS_Y, ev_abs_bits) ||
-                    (!test_bit(BTN_TRIGGER, ev_key_bits) && !test_bit(BTN_A, ev_key_bits) && !test_bit(BTN_1, ev_key_bits))) {
-                    close(fd);
-                    continue;
-                }
+    if (!ioctl(fd, EVIOCGID, &id)) {
+        device->vendor_id = id.vendor;
+        device->product_id = id.product;
+    } else {
+        device->vendor_id = device->product_id = 0;
+    }
 
-                hal_gamepad_device_t *device = malloc(sizeof(hal_gamepad_device_t));
-                device->device_id = next_device_id++;
-                devices = realloc(devices, sizeof(hal_gamepad_device_t *) * (num_devices + 1));
-                devices[num_devices++] = device;
-
-                hal_gamepad_private_t *priv = malloc(sizeof(hal_gamepad_private_t));
-                priv->fd = fd;
-                priv->path = malloc(strlen(file_name) + 1);
-                strcpy(priv->path, file_name);
-                memset(priv->button_map, 0xFF, sizeof(priv->button_map));
-                memset(priv->axis_map, 0xFF, sizeof(priv->axis_map));
-                device->private_data = priv;
-
-                if (ioctl(fd, EVIOCGNAME(sizeof(name)), name) > 0) {
-                    description = malloc(strlen(name) + 1);
-                    strcpy(description, name);
-                } else {
-                    description = malloc(strlen(file_name) + 1);
-                    strcpy(description, file_name);
-                }
-                device->description = description;
+    memset(ev_key_bits, 0, sizeof(ev_key_bits));
+    memset(ev_abs_bits, 0, sizeof(ev_abs_bits));
+    ioctl(fd, EVIOCGBIT(EV_KEY, sizeof(ev_key_bits)), ev_key_bits);
+    ioctl(fd, EVIOCGBIT(EV_ABS, sizeof(ev_abs_bits)), ev_abs_bits);
 
-                if (!ioctl(fd, EVIOCGID, &id)) {
-                    device->vendor_id = id.vendor;
-                    device->product_id = id.product;
-                } else {
-                    device->vendor_id = device->product_id = 0;
-                }
+    device->num_axes = 0;
+    for (int bit = 0; bit < ABS_CNT; bit++) {
+        if (test_bit(bit, ev_abs_bits)) {
+            if (ioctl(fd, EVIOCGABS(bit), &priv->axis_info[bit]) < 0 ||
+                priv->axis_info[bit].minimum == priv->axis_info[bit].maximum)
+                continue;
+            priv->axis_map[bit] = device->num_axes;
+            device->num_axes++;
+        }
+    }
 
-                memset(ev_key_bits, 0, sizeof(ev_key_bits));
-                memset(ev_abs_bits, 0, sizeof(ev_abs_bits));
-                ioctl(fd, EVIOCGBIT(EV_KEY, sizeof(ev_key_bits)), ev_key_bits);
-                ioctl(fd, EVIOCGBIT(EV_ABS, sizeof(ev_abs_bits)), ev_abs_bits);
-
-                device->num_axes = 0;
-                for (int bit = 0; bit < ABS_CNT; bit++) {
-                    if (test_bit(bit, ev_abs_bits)) {
-                        if (ioctl(fd, EVIOCGABS(bit), &priv->axis_info[bit]) < 0 ||
-                            priv->axis_info[bit].minimum == priv->axis_info[bit].maximum)
-                            continue;
-                        priv->axis_map[bit] = device->num_axes;
-                        device->num_axes++;
-                    }
-                }
+    device->num_buttons = 0;
+    for (int bit = BTN_MISC; bit < KEY_CNT; bit++) {
+        if (test_bit(bit, ev_key_bits)) {
+            priv->button_map[bit - BTN_MISC] = device->num_buttons;
+            device->num_buttons++;
+        }
+    }
 
-                device->num_buttons = 0;
-                for (int bit = BTN_MISC; bit < KEY_CNT; bit++) {
-                    if (test_bit(bit, ev_key_bits)) {
-                        priv->button_map[bit - BTN_MISC] = device->num_buttons;
-                        device->num_buttons++;
-                    }
-                }
+    device->axis_states = calloc(sizeof(float), device->num_axes);
+    device->axis_filters = NULL;
+    device->button_states = calloc(sizeof(bool), device->num_buttons);
+    priv->latest_axes = calloc(sizeof(hal_gamepad_event_t), device->num_axes);
+    priv->latest_dirty = calloc(sizeof(bool), device->num_axes);
+    atomic_init(&priv->state_sequence, 0);
+    ring_init(&priv->ring, device->num_axes);
+    hal_gamepad_resolve_mapping(device);
+    return device;
+}
+
+/* Report a newly opened device and start reading it. Devices found off the
+   application's thread are announced later by hal_gamepad_process_events. */
+static void attach_device(hal_gamepad_device_t *device, bool announce_now) {
+    if (announce_now) {
+        if (hal_gamepad_attach_cb != NULL)
+            hal_gamepad_attach_cb(device, hal_gamepad_attach_ctx);
+    } else {
+        attached_devices = realloc(attached_devices, sizeof(hal_gamepad_device_t *) * (num_attached_devices + 1));
+        attached_devices[num_attached_devices++] = device;
+    }
+    start_device(device);
+}
 
-                device->axis_states = calloc(sizeof(float), device->num_axes);
-                device->button_states = calloc(sizeof(bool), device->num_buttons);
+static void scan_devices(bool announce_now) {
+    DIR *dev_input;
+    struct dirent *entity;
+    char file_name[PATH_MAX];
+    struct stat stat_buf;
+    time_t current_time;
 
-                if (hal_gamepad_attach_cb != NULL)
-                    hal_gamepad_attach_cb(device, hal_gamepad_attach_ctx);
+    pthread_mutex_lock(&devices_mutex);
 
-                pthread_create(&priv->thread, NULL, device_thread, device);
-            }
+    dev_input = opendir("/dev/input");
+    current_time = time(NULL);
+    if (dev_input != NULL) {
+        while ((entity = readdir(dev_input)) != NULL) {
+            if (!is_event_node(entity->d_name))
+                continue;
+            snprintf(file_name, PATH_MAX, "/dev/input/%s", entity->d_name);
+            if (stat(file_name, &stat_buf) || stat_buf.st_mtime < last_input_stat_time)
+                continue;
+            if (is_known_device(file_name))
+                continue;
+
+            hal_gamepad_device_t *device = open_device(file_name);
+            if (device != NULL)
+                attach_device(device, announce_now);
         }
         closedir(dev_input);
     }
@@ -356,41 +672,100 @@ void hal_gamepad_detect_devices(void) {
     pthread_mutex_unlock(&devices_mutex);
 }
 
-static void process_queued_event(hal_gamepad_queued_event_t event) {
-    switch (event.event_type) {
-        case HAL_GAMEPAD_EVENT_ATTACHED:
-            if (hal_gamepad_attach_cb != NULL)
-                hal_gamepad_attach_cb(event.event_data, hal_gamepad_attach_ctx);
-            break;
+void hal_gamepad_detect_devices(void) {
+    if (inited)
+        scan_devices(true);
+}
 
-        case HAL_GAMEPAD_EVENT_REMOVED:
-            if (hal_gamepad_remove_cb != NULL)
-                hal_gamepad_remove_cb(event.event_data, hal_gamepad_remove_ctx);
-            break;
+/* Handle /dev/input changes. Nodes appear root-owned and udev fixes their
+   permissions afterwards, so IN_ATTRIB retries nodes that failed to open. */
+static void hotplug_read(void) {
+    char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    char file_name[PATH_MAX];
+    ssize_t length;
+
+    while ((length = read(hotplug_fd, buffer, sizeof(buffer))) > 0) {
+        pthread_mutex_lock(&devices_mutex);
+        for (char *ptr = buffer; ptr < buffer + length; ) {
+            const struct inotify_event *event = (const struct inotify_event *)ptr;
+            ptr += sizeof(struct inotify_event) + event->len;
+
+            if (event->mask & IN_Q_OVERFLOW) {
+                /* Events were lost, fall back to one full scan */
+                last_input_stat_time = 0;
+                scan_devices(false);
+                continue;
+            }
+            if (event->len == 0 || !is_event_node(event->name))
+                continue;
+
+            snprintf(file_name, PATH_MAX, "/dev/input/%s", event->name);
+            if (is_known_device(file_name))
+                continue;
 
+            hal_gamepad_device_t *device = open_device(file_name);
+            if (device != NULL)
+                attach_device(device, false);
+        }
+        pthread_mutex_unlock(&devices_mutex);
+    }
+}
+
+static void process_event(const hal_gamepad_event_t *event) {
+    switch (event->event_type) {
         case HAL_GAMEPAD_EVENT_BUTTON_DOWN:
-            if (hal_gamepad_button_down_cb != NULL) {
-                hal_gamepad_button_event_t *e = event.event_data;
-                hal_gamepad_button_down_cb(e->device, e->button_id, e->timestamp, hal_gamepad_button_down_ctx);
-            }
+            if (hal_gamepad_button_down_cb != NULL)
+                hal_gamepad_button_down_cb(event->device, event->button.button_id, event->timestamp, hal_gamepad_button_down_ctx);
             break;
 
         case HAL_GAMEPAD_EVENT_BUTTON_UP:
-            if (hal_gamepad_button_up_cb != NULL) {
-                hal_gamepad_button_event_t *e = event.event_data;
-                hal_gamepad_button_up_cb(e->device, e->button_id, e->timestamp, hal_gamepad_button_up_ctx);
-            }
+            if (hal_gamepad_button_up_cb != NULL)
+                hal_gamepad_button_up_cb(event->device, event->button.button_id, event->timestamp, hal_gamepad_button_up_ctx);
             break;
 
         case HAL_GAMEPAD_EVENT_AXIS_MOVED:
-            if (hal_gamepad_axis_cb != NULL) {
-                hal_gamepad_axis_event_t *e = event.event_data;
-                hal_gamepad_axis_cb(e->device, e->axis_id, e->value, e->last_value, e->timestamp, hal_gamepad_axis_ctx);
-            }
+            if (hal_gamepad_axis_cb != NULL)
+                hal_gamepad_axis_cb(event->device, event->axis.axis_id, event->axis.value, event->axis.last_value, event->timestamp, hal_gamepad_axis_ctx);
+            break;
+
+        default:
             break;
     }
 }
 
+/* Buttons are delivered in order; each axis reports only its latest value,
+   once, after the buttons unless raw axis events were requested */
+static void process_device_events(hal_gamepad_device_t *device) {
+    hal_gamepad_private_t *priv = device->private_data;
+    hal_gamepad_event_t event;
+    bool any_axis = false;
+
+    while (ring_pop(&priv->ring, &event)) {
+        if (event.event_type != HAL_GAMEPAD_EVENT_AXIS_MOVED || hal_gamepad_raw_axes ||
+            event.axis.axis_id >= device->num_axes) {
+            process_event(&event);
+            continue;
+        }
+
+        hal_gamepad_event_t *latest = &priv->latest_axes[event.axis.axis_id];
+        if (priv->latest_dirty[event.axis.axis_id])
+            event.axis.last_value = latest->axis.last_value;
+        *latest = event;
+        priv->latest_dirty[event.axis.axis_id] = true;
+        any_axis = true;
+    }
+
+    if (!any_axis)
+        return;
+    for (unsigned int i = 0; i < device->num_axes; i++) {
+        if (!priv->latest_dirty[i])
+            continue;
+        priv->latest_dirty[i] = false;
+        if (priv->latest_axes[i].axis.value != priv->latest_axes[i].axis.last_value)
+            process_event(&priv->latest_axes[i]);
+    }
+}
+
 void hal_gamepad_process_events(void) {
     static bool in_process_events = false;
 
@@ -398,17 +773,129 @@ void hal_gamepad_process_events(void) {
         return;
 
     in_process_events = true;
-    pthread_mutex_lock(&event_queue_mutex);
-    for (size_t i = 0; i < event_count; i++) {
-        process_queued_event(event_queue[i]);
-        if (event_queue[i].event_type == HAL_GAMEPAD_EVENT_REMOVED)
-            dispose_device(event_queue[i].event_data);
-        else if (event_queue[i].event_type != HAL_GAMEPAD_EVENT_ATTACHED)
-            free(event_queue[i].event_data);
+    pthread_mutex_lock(&devices_mutex);
+
+    /* Announce hotplugged devices before any of their input */
+    for (unsigned int i = 0; i < num_attached_devices; i++)
+        if (hal_gamepad_attach_cb != NULL)
+            hal_gamepad_attach_cb(attached_devices[i], hal_gamepad_attach_ctx);
+    num_attached_devices = 0;
+
+    for (unsigned int i = 0; i < num_devices; i++)
+        process_device_events(devices[i]);
+
+    /* Deliver what removed devices queued before they went away */
+    for (unsigned int i = 0; i < num_removed_devices; i++) {
+        hal_gamepad_device_t *device = removed_devices[i];
+        hal_gamepad_private_t *priv = device->private_data;
+        if (priv->has_thread)
+            pthread_join(priv->thread, NULL);
+        process_device_events(device);
+        if (hal_gamepad_remove_cb != NULL)
+            hal_gamepad_remove_cb(device, hal_gamepad_remove_ctx);
+        dispose_device(device);
     }
-    event_count = 0;
-    pthread_mutex_unlock(&event_queue_mutex);
+    num_removed_devices = 0;
+    pthread_mutex_unlock(&devices_mutex);
     in_process_events = false;
 }
 
+int hal_gamepad_poll(int timeout_ms) {
+    if (!inited || io_mode != HAL_GAMEPAD_IO_MANUAL)
+        return 0;
+    return reactor_wait(timeout_ms);
+}
+
+bool hal_gamepad_get_snapshot(hal_gamepad_device_t *device, hal_gamepad_snapshot_t *snapshot) {
+    if (!device || !snapshot)
+        return false;
+
+    hal_gamepad_private_t *priv = device->private_data;
+    unsigned int before, after;
+    do {
+        while ((before = atomic_load_explicit(&priv->state_sequence, memory_order_acquire)) & 1)
+            ;
+        hal_gamepad_fill_snapshot(device, snapshot);
+        atomic_thread_fence(memory_order_acquire);
+        after = atomic_load_explicit(&priv->state_sequence, memory_order_relaxed);
+    } while (before != after);
+    return true;
+}
+
+static hal_gamepad_event_t device_event(hal_gamepad_event_type_t event_type, hal_gamepad_device_t *device) {
+    hal_gamepad_event_t event;
+    struct timespec now;
+
+    /* Same clock as evdev input timestamps */
+    clock_gettime(CLOCK_REALTIME, &now);
+    memset(&event, 0, sizeof(event));
+    event.event_type = event_type;
+    event.device = device;
+    event.timestamp = now.tv_sec + now.tv_nsec * 0.000000001;
+    return event;
+}
+
+static size_t drain_device_events(hal_gamepad_device_t *device, hal_gamepad_event_t *out, size_t max) {
+    hal_gamepad_private_t *priv = device->private_data;
+    size_t count = 0;
+    while (count < max && ring_pop(&priv->ring, &out[count]))
+        count++;
+    return count;
+}
+
+size_t hal_gamepad_drain_events(hal_gamepad_event_t *out, size_t max) {
+    size_t count = 0;
+    unsigned int announced = 0;
+    unsigned int finished = 0;
+
+    if (!inited || out == NULL)
+        return 0;
+
+    pthread_mutex_lock(&devices_mutex);
+
+    for (unsigned int i = 0; i < num_retired_devices; i++)
+        dispose_device(retired_devices[i]);
+    num_retired_devices = 0;
+
+    while (announced < num_attached_devices && count < max)
+        out[count++] = device_event(HAL_GAMEPAD_EVENT_ATTACHED, attached_devices[announced++]);
+    num_attached_devices -= announced;
+    if (announced > 0)
+        memmove(attached_devices, attached_devices + announced, sizeof(hal_gamepad_device_t *) * num_attached_devices);
+
+    for (unsigned int i = 0; i < num_devices && count < max; i++)
+        count += drain_device_events(devices[i], out + count, max - count);
+
+    /* Removed devices report their remaining input, then their removal */
+    while (finished < num_removed_devices && count < max) {
+        hal_gamepad_device_t *device = removed_devices[finished];
+        hal_gamepad_private_t *priv = device->private_data;
+        if (priv->has_thread) {
+            pthread_join(priv->thread, NULL);
+            priv->has_thread = false;
+        }
+        count += drain_device_events(device, out + count, max - count);
+        if (count == max)
+            break;
+
+        out[count++] = device_event(HAL_GAMEPAD_EVENT_REMOVED, device);
+        retired_devices = realloc(retired_devices, sizeof(hal_gamepad_device_t *) * (num_retired_devices + 1));
+        retired_devices[num_retired_devices++] = device;
+        finished++;
+    }
+    num_removed_devices -= finished;
+    if (finished > 0)
+        memmove(removed_devices, removed_devices + finished, sizeof(hal_gamepad_device_t *) * num_removed_devices);
+
+    pthread_mutex_unlock(&devices_mutex);
+    return count;
+}
+
+unsigned long long hal_gamepad_dropped_events(hal_gamepad_device_t *device) {
+    if (!device)
+        return 0;
+    hal_gamepad_private_t *priv = device->private_data;
+    return atomic_load_explicit(&priv->ring.dropped, memory_order_relaxed);
+}
+
 #endif /* HAL_NO_GAMEPAD */
@@ -161,8 +161,10 @@ static void on_device_value_changed(void *context, IOReturn result, void *sender
                 float float_value = (int_value - priv->axis_elements[i].logical_min) / 
                     (float)(priv->axis_elements[i].logical_max - priv->axis_elements[i].logical_min) * 2.0f - 1.0f;
                 
-                queue_axis_event(device, timestamp, i, float_value, device->axis_states[i]);
-                device->axis_states[i] = float_value;
+                if (hal_gamepad_filter_axis(device, i, &float_value)) {
+                    queue_axis_event(device, timestamp, i, float_value, device->axis_states[i]);
+                    device->axis_states[i] = float_value;
+                }
             }
             return;
         }
@@ -200,6 +202,7 @@ static void on_device_matched(void *context, IOReturn result, void *sender, IOHI
     dev->product_id = iohid_device_get_int_property(device, CFSTR(kIOHIDProductIDKey));
     dev->num_axes = 0;
     dev->num_buttons = 0;
+    hal_gamepad_resolve_mapping(dev);
     
     devices = realloc(devices, sizeof(hal_gamepad_device_t *) * (num_devices + 1));
     devices[num_devices++] = dev;
@@ -255,6 +258,7 @@ static void on_device_matched(void *context, IOReturn result, void *sender, IOHI
     CFRelease(elements);
 
     dev->axis_states = calloc(sizeof(float), dev->num_axes);
+    dev->axis_filters = NULL;
     dev->button_states = calloc(sizeof(bool), dev->num_buttons);
 
     IOHIDDeviceRegisterInputValueCallback(device, on_device_value_changed, dev);
@@ -300,6 +304,7 @@ static void dispose_device(hal_gamepad_device_t *device) {
     free(priv);
     free((void *)device->description);
     free(device->axis_states);
+    free(device->axis_filters);
     free(device->button_states);
     free(device);
 }
@@ -332,6 +337,7 @@ void hal_gamepad_init(void) {
     if (hid_manager != NULL)
         return;
 
+    hal_gamepad_mapping_init();
     hid_manager = IOHIDManagerCreate(kCFAllocatorDefault, kIOHIDOptionsTypeNone);
 
     CFStringRef keys[2];
@@ -483,4 +489,31 @@ void hal_gamepad_process_events(void) {
     in_process_events = false;
 }
 
+int hal_gamepad_poll(int timeout_ms) {
+    (void)timeout_ms;
+    return 0;
+}
+
+bool hal_gamepad_get_snapshot(hal_gamepad_device_t *device, hal_gamepad_snapshot_t *snapshot) {
+    /* State is only updated on the thread that processes events */
+    if (!device || !snapshot)
+        return false;
+    hal_gamepad_fill_snapshot(device, snapshot);
+    return true;
+}
+
+size_t hal_gamepad_drain_events(hal_gamepad_event_t *out, size_t max) {
+    if (hid_manager == NULL || out == NULL)
+        return 0;
+
+    CFRunLoopRunInMode(HAL_GAMEPAD_RUN_LOOP_MODE, 0, true);
+    return hal_gamepad_drain_queued_events(input_event_queue, &input_event_count, out, max);
+}
+
+unsigned long long hal_gamepad_dropped_events(hal_gamepad_device_t *device) {
+    /* Events are not held in a bounded queue on this platform */
+    (void)device;
+    return 0;
+}
+
 #endif /* HAL_NO_GAMEPAD */
@@ -0,0 +1,538 @@
+/* https://github.com/takeiteasy/hal
+
+ hal Copyright (C) 2025 George Watson
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>. */
+
+/* Work-stealing thread pool - shared by all threads backends */
+
+#ifndef HAL_NO_THREADS
+#ifndef HAL_NO_CPU_COUNT
+#define HAL_POOL_CPU_COUNT
+#endif
+#include "hal/threads.h"
+#ifdef HAL_POOL_CPU_COUNT
+#include "hal/cpu_count.h"
+#endif
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define HAL_POOL_THREAD_LOCAL __declspec(thread)
+#else
+#define HAL_POOL_THREAD_LOCAL _Thread_local
+#endif
+
+#if defined(PLATFORM_WINDOWS) && !defined(HAL_POOL_CPU_COUNT)
+#include <windows.h>
+#elif !defined(HAL_POOL_CPU_COUNT)
+#include <unistd.h>
+#endif
+
+#define HAL_POOL_DEQUE_CAPACITY 256
+#define HAL_POOL_MAX_THREADS 256
+/* Failed searches before an idle worker sleeps or a waiter blocks */
+#define HAL_POOL_SPIN 64
+/* Splits per worker when parallel_for picks the grain */
+#define HAL_POOL_SPLITS 8
+
+typedef struct pool_task {
+    void (*run)(struct pool_task *task);
+    hal_pool_task_t func;
+    void *userdata;
+    hal_pool_group_t *group;
+    size_t begin, end;
+    struct pool_task *next;
+} pool_task_t;
+
+/* Deque storage, retired arrays stay alive until the pool is destroyed
+   because a thief may still be reading from one */
+typedef struct pool_array {
+    struct pool_array *previous;
+    int64_t capacity;
+    hal_atomic_ptr_t slots[];
+} pool_array_t;
+
+typedef struct pool_worker {
+    hal_atomic64_t top;
+    hal_atomic64_t bottom;
+    hal_atomic_ptr_t array;
+    hal_pool_t *pool;
+    unsigned int seed;
+    hal_thrd_t thread;
+    char padding[64];
+} pool_worker_t;
+
+struct hal_pool {
+    pool_worker_t *workers;
+    unsigned int count;
+    /* Tasks from threads outside the pool, guarded by lock */
+    pool_task_t *inject_head, *inject_tail;
+    hal_atomic64_t injected;
+    hal_atomic64_t sleepers;
+    hal_atomic64_t stop;
+    hal_mtx_t lock;
+    hal_cnd_t wake;
+};
+
+struct hal_pool_group {
+    hal_pool_t *pool;
+    hal_atomic64_t pending;
+    hal_mtx_t lock;
+    hal_cnd_t done;
+};
+
+typedef struct pool_range {
+    hal_pool_range_t func;
+    void *userdata;
+    size_t grain;
+} pool_range_t;
+
+static HAL_POOL_THREAD_LOCAL pool_worker_t *pool_self = NULL;
+
+static pool_array_t* pool_array_new(int64_t capacity, pool_array_t *previous) {
+    pool_array_t *array = (pool_array_t*)malloc(sizeof(pool_array_t) + capacity * sizeof(hal_atomic_ptr_t));
+    if (!array)
+        return NULL;
+    array->previous = previous;
+    array->capacity = capacity;
+    return array;
+}
+
+/* Owner only */
+static bool pool_deque_push(pool_worker_t *worker, pool_task_t *task) {
+    int64_t b = hal_atomic_load64(&worker->bottom, HAL_MEMORY_RELAXED);
+    int64_t t = hal_atomic_load64(&worker->top, HAL_MEMORY_ACQUIRE);
+    pool_array_t *array = (pool_array_t*)hal_atomic_load_ptr(&worker->array, HAL_MEMORY_ACQUIRE);
+    if (b - t > array->capacity - 1) {
+        pool_array_t *bigger = pool_array_new(array->capacity * 2, array);
+        if (!bigger)
+            return false;
+        for (int64_t i = t; i < b; i++)
+            hal_atomic_store_ptr(&bigger->slots[i & (bigger->capacity - 1)],
+                                 hal_atomic_load_ptr(&array->slots[i & (array->capacity - 1)], HAL_MEMORY_RELAXED),
+                                 HAL_MEMORY_RELAXED);
+        hal_atomic_store_ptr(&worker->array, bigger, HAL_MEMORY_RELEASE);
+        array = bigger;
+    }
+    hal_atomic_store_ptr(&array->slots[b & (array->capacity - 1)], task, HAL_MEMORY_RELEASE);
+    hal_atomic_store64(&worker->bottom, b + 1, HAL_MEMORY_RELEASE);
+    return true;
+}
+
+/* Owner only, LIFO end */
+static pool_task_t* pool_deque_take(pool_worker_t *worker) {
+    int64_t b = hal_atomic_load64(&worker->bottom, HAL_MEMORY_RELAXED) - 1;
+    pool_array_t *array = (pool_array_t*)hal_atomic_load_ptr(&worker->array, HAL_MEMORY_ACQUIRE);
+    hal_atomic_store64(&worker->bottom, b, HAL_MEMORY_RELAXED);
+    hal_thread_fence(HAL_MEMORY_SEQ_CST);
+    int64_t t = hal_atomic_load64(&worker->top, HAL_MEMORY_RELAXED);
+    if (t > b) {
+        hal_atomic_store64(&worker->bottom, b + 1, HAL_MEMORY_RELAXED);
+        return NULL;
+    }
+    pool_task_t *task = (pool_task_t*)hal_atomic_load_ptr(&array->slots[b & (array->capacity - 1)], HAL_MEMORY_ACQUIRE);
+    if (t == b) {
+        /* Last task, race thieves for it */
+        if (!hal_atomic_cas64(&worker->top, &t, t + 1, HAL_MEMORY_SEQ_CST))
+            task = NULL;
+        hal_atomic_store64(&worker->bottom, b + 1, HAL_MEMORY_RELAXED);
+    }
+    return task;
+}
+
+/* Any thread, FIFO end */
+static pool_task_t* pool_deque_steal(pool_worker_t *worker) {
+    int64_t t = hal_atomic_load64(&worker->top, HAL_MEMORY_ACQUIRE);
+    hal_thread_fence(HAL_MEMORY_SEQ_CST);
+    int64_t b = hal_atomic_load64(&worker->bottom, HAL_MEMORY_ACQUIRE);
+    if (t >= b)
+        return NULL;
+    pool_array_t *array = (pool_array_t*)hal_atomic_load_ptr(&worker->array, HAL_MEMORY_ACQUIRE);
+    pool_task_t *task = (pool_task_t*)hal_atomic_load_ptr(&array->slots[t & (array->capacity - 1)], HAL_MEMORY_ACQUIRE);
+    return hal_atomic_cas64(&worker->top, &t, t + 1, HAL_MEMORY_SEQ_CST) ? task : NULL;
+}
+
+static bool pool_has_work(hal_pool_t *pool) {
+    if (hal_atomic_load64(&pool->injected, HAL_MEMORY_ACQUIRE) > 0)
+        return true;
+    for (unsigned int i = 0; i < pool->count; i++)
+        if (hal_atomic_load64(&pool->workers[i].top, HAL_MEMORY_ACQUIRE) < hal_atomic_load64(&pool->workers[i].bottom, HAL_MEMORY_ACQUIRE))
+            return true;
+    return false;
+}
+
+/* Pairs with the sleepers increment in pool_sleep, one side always sees the other */
+static void pool_notify(hal_pool_t *pool) {
+    hal_thread_fence(HAL_MEMORY_SEQ_CST);
+    if (hal_atomic_load64(&pool->sleepers, HAL_MEMORY_RELAXED) > 0) {
+        hal_mtx_lock(&pool->lock);
+        hal_cnd_signal(&pool->wake);
+        hal_mtx_unlock(&pool->lock);
+    }
+}
+
+static bool pool_push(hal_pool_t *pool, pool_task_t *task) {
+    pool_worker_t *self = pool_self;
+    if (self && self->pool == pool) {
+        if (!pool_deque_push(self, task))
+            return false;
+    } else {
+        task->next = NULL;
+        hal_mtx_lock(&pool->lock);
+        if (pool->inject_tail)
+            pool->inject_tail->next = task;
+        else
+            pool->inject_head = task;
+        pool->inject_tail = task;
+        hal_atomic_fetch_add64(&pool->injected, 1, HAL_MEMORY_SEQ_CST);
+        hal_mtx_unlock(&pool->lock);
+    }
+    pool_notify(pool);
+    return true;
+}
+
+static pool_task_t* pool_find(hal_pool_t *pool, pool_worker_t *self) {
+    pool_task_t *task = NULL;
+    if (self && (task = pool_deque_take(self)))
+        return task;
+    if (hal_atomic_load64(&pool->injected, HAL_MEMORY_ACQUIRE) > 0) {
+        hal_mtx_lock(&pool->lock);
+        if ((task = pool->inject_head)) {
+            if (!(pool->inject_head = task->next))
+                pool->inject_tail = NULL;
+            hal_atomic_fetch_add64(&pool->injected, -1, HAL_MEMORY_SEQ_CST);
+        }
+        hal_mtx_unlock(&pool->lock);
+        if (task)
+            return task;
+    }
+    /* xorshift picks where to start so thieves spread out */
+    unsigned int seed = self ? self->seed : (unsigned int)(size_t)&task;
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    if (self)
+        self->seed = seed;
+    for (unsigned int i = 0; i < pool->count; i++) {
+        pool_worker_t *victim = &pool->workers[(seed + i) % pool->count];
+        if (victim != self && (task = pool_deque_steal(victim)))
+            return task;
+    }
+    return NULL;
+}
+
+static void pool_group_finish(hal_pool_group_t *group) {
+    for (;;) {
+        int64_t pending = hal_atomic_load64(&group->pending, HAL_MEMORY_ACQUIRE);
+        if (pending > 1) {
+            if (hal_atomic_cas64(&group->pending, &pending, pending - 1, HAL_MEMORY_ACQ_REL))
+                return;
+            continue;
+        }
+        /* The last decrement happens under the lock so a waiter can't free
+           the group while this thread is still signalling it */
+        hal_mtx_lock(&group->lock);
+        hal_atomic_fetch_add64(&group->pending, -1, HAL_MEMORY_SEQ_CST);
+        hal_cnd_broadcast(&group->done);
+        hal_mtx_unlock(&group->lock);
+        return;
+    }
+}
+
+static void pool_execute(pool_task_t *task) {
+    hal_pool_group_t *group = task->group;
+    task->run(task);
+    free(task);
+    if (group)
+        pool_group_finish(group);
+}
+
+static void pool_run_task(pool_task_t *task) {
+    task->func(task->userdata);
+}
+
+static pool_task_t* pool_task_new(hal_pool_group_t *group, void (*run)(pool_task_t*), hal_pool_task_t func, void *userdata) {
+    pool_task_t *task = (pool_task_t*)malloc(sizeof(pool_task_t));
+    if (!task)
+        return NULL;
+    memset(task, 0, sizeof(pool_task_t));
+    task->run = run;
+    task->func = func;
+    task->userdata = userdata;
+    task->group = group;
+    if (group)
+        hal_atomic_fetch_add64(&group->pending, 1, HAL_MEMORY_SEQ_CST);
+    return task;
+}
+
+/* Undo pool_task_new for a task that never got queued */
+static void pool_task_cancel(pool_task_t *task) {
+    if (task->group)
+        hal_atomic_fetch_add64(&task->group->pending, -1, HAL_MEMORY_SEQ_CST);
+    free(task);
+}
+
+/* Keep the upper half of the slice for thieves until it fits the grain */
+static void pool_run_range(pool_task_t *task) {
+    pool_range_t *range = (pool_range_t*)task->userdata;
+    size_t begin = task->begin, end = task->end;
+    while (end - begin > range->grain) {
+        size_t middle = begin + (end - begin) / 2;
+        pool_task_t *half = pool_task_new(task->group, pool_run_range, NULL, range);
+        if (!half)
+            break;
+        half->begin = middle;
+        half->end = end;
+        if (!pool_push(task->group->pool, half)) {
+            pool_task_cancel(half);
+            break;
+        }
+        end = middle;
+    }
+    range->func(begin, end, range->userdata);
+}
+
+static void pool_sleep(hal_pool_t *pool) {
+    hal_mtx_lock(&pool->lock);
+    hal_atomic_fetch_add64(&pool->sleepers, 1, HAL_MEMORY_SEQ_CST);
+    hal_thread_fence(HAL_MEMORY_SEQ_CST);
+    if (!hal_atomic_load64(&pool->stop, HAL_MEMORY_RELAXED) && !pool_has_work(pool))
+        hal_cnd_wait(&pool->wake, &pool->lock);
+    hal_atomic_fetch_add64(&pool->sleepers, -1, HAL_MEMORY_SEQ_CST);
+    hal_mtx_unlock(&pool->lock);
+}
+
+static int pool_worker_main(void *arg) {
+    pool_worker_t *self = (pool_worker_t*)arg;
+    hal_pool_t *pool = self->pool;
+    pool_self = self;
+    unsigned int misses = 0;
+    for (;;) {
+        pool_task_t *task = pool_find(pool, self);
+        if (task) {
+            pool_execute(task);
+            misses = 0;
+            continue;
+        }
+        if (hal_atomic_load64(&pool->stop, HAL_MEMORY_ACQUIRE) && !pool_has_work(pool))
+            break;
+        if (++misses < HAL_POOL_SPIN) {
+            hal_thrd_yield();
+            continue;
+        }
+        pool_sleep(pool);
+        misses = 0;
+    }
+    pool_self = NULL;
+    return 0;
+}
+
+static unsigned int pool_default_threads(void) {
+#if defined(HAL_POOL_CPU_COUNT)
+    int count = hal_cpu_count_logical();
+#elif defined(PLATFORM_WINDOWS)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    int count = (int)info.dwNumberOfProcessors;
+#else
+    int count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return count > 0 ? (unsigned int)count : 1;
+}
+
+static void pool_free(hal_pool_t *pool) {
+    for (unsigned int i = 0; i < pool->count; i++) {
+        pool_array_t *array = (pool_array_t*)hal_atomic_load_ptr(&pool->workers[i].array, HAL_MEMORY_ACQUIRE);
+        while (array) {
+            pool_array_t *previous = array->previous;
+            free(array);
+            array = previous;
+        }
+    }
+    hal_cnd_destroy(&pool->wake);
+    hal_mtx_destroy(&pool->lock);
+    free(pool->workers);
+    free(pool);
+}
+
+/* Stop and join the first count workers */
+static void pool_stop(hal_pool_t *pool, unsigned int count) {
+    hal_mtx_lock(&pool->lock);
+    hal_atomic_store64(&pool->stop, 1, HAL_MEMORY_RELEASE);
+    hal_cnd_broadcast(&pool->wake);
+    hal_mtx_unlock(&pool->lock);
+    for (unsigned int i = 0; i < count; i++)
+        hal_thrd_join(pool->workers[i].thread, NULL);
+}
+
+hal_pool_t* hal_pool_create(unsigned int threads) {
+    if (!threads)
+        threads = pool_default_threads();
+    if (threads > HAL_POOL_MAX_THREADS)
+        threads = HAL_POOL_MAX_THREADS;
+    hal_pool_t *pool = (hal_pool_t*)malloc(sizeof(hal_pool_t));
+    if (!pool)
+        return NULL;
+    memset(pool, 0, sizeof(hal_pool_t));
+    if (!(pool->workers = (pool_worker_t*)calloc(threads, sizeof(pool_worker_t)))) {
+        free(pool);
+        return NULL;
+    }
+    hal_mtx_init(&pool->lock, HAL_MTX_PLAIN);
+    hal_cnd_init(&pool->wake);
+    pool->count = threads;
+    for (unsigned int i = 0; i < threads; i++) {
+        pool_worker_t *worker = &pool->workers[i];
+        worker->pool = pool;
+        worker->seed = 2654435761u * (i + 1);
+        pool_array_t *array = pool_array_new(HAL_POOL_DEQUE_CAPACITY, NULL);
+        if (!array) {
+            pool_free(pool);
+            return NULL;
+        }
+        hal_atomic_store_ptr(&worker->array, array, HAL_MEMORY_RELEASE);
+    }
+    for (unsigned int i = 0; i < threads; i++)
+        if (hal_thrd_create(&pool->workers[i].thread, pool_worker_main, &pool->workers[i]) != HAL_THRD_SUCCESS) {
+            pool_stop(pool, i);
+            pool_free(pool);
+            return NULL;
+        }
+    return pool;
+}
+
+void hal_pool_destroy(hal_pool_t *pool) {
+    if (!pool)
+        return;
+    pool_stop(pool, pool->count);
+    pool_free(pool);
+}
+
+static hal_lock_t shared_lock = HAL_LOCK_INIT;
+static hal_atomic_ptr_t shared_pool = HAL_ATOMIC_INIT(NULL);
+
+hal_pool_t* hal_pool_shared(void) {
+    hal_pool_t *pool = (hal_pool_t*)hal_atomic_load_ptr(&shared_pool, HAL_MEMORY_ACQUIRE);
+    if (pool)
+        return pool;
+    hal_lock_lock(&shared_lock);
+    /* A failed start is retried by the next caller */
+    if (!(pool = (hal_pool_t*)hal_atomic_load_ptr(&shared_pool, HAL_MEMORY_RELAXED)) &&
+        (pool = hal_pool_create(0)) != NULL)
+        hal_atomic_store_ptr(&shared_pool, pool, HAL_MEMORY_RELEASE);
+    hal_lock_unlock(&shared_lock);
+    return pool;
+}
+
+unsigned int hal_pool_size(const hal_pool_t *pool) {
+    return pool ? pool->count : 0;
+}
+
+static void pool_group_init(hal_pool_group_t *group, hal_pool_t *pool) {
+    group->pool = pool;
+    hal_atomic_store64(&group->pending, 0, HAL_MEMORY_RELAXED);
+    hal_mtx_init(&group->lock, HAL_MTX_PLAIN);
+    hal_cnd_init(&group->done);
+}
+
+static void pool_group_release(hal_pool_group_t *group) {
+    hal_cnd_destroy(&group->done);
+    hal_mtx_destroy(&group->lock);
+}
+
+hal_pool_group_t* hal_pool_group_create(hal_pool_t *pool) {
+    if (!pool)
+        return NULL;
+    hal_pool_group_t *group = (hal_pool_group_t*)malloc(sizeof(hal_pool_group_t));
+    if (group)
+        pool_group_init(group, pool);
+    return group;
+}
+
+void hal_pool_group_destroy(hal_pool_group_t *group) {
+    if (!group)
+        return;
+    hal_pool_wait(group);
+    pool_group_release(group);
+    free(group);
+}
+
+bool hal_pool_submit(hal_pool_t *pool, hal_pool_group_t *group, hal_pool_task_t task, void *userdata) {
+    if (!pool || !task || (group && group->pool != pool))
+        return false;
+    pool_task_t *item = pool_task_new(group, pool_run_task, task, userdata);
+    if (!item)
+        return false;
+    if (!pool_push(pool, item)) {
+        pool_task_cancel(item);
+        return false;
+    }
+    return true;
+}
+
+void hal_pool_wait(hal_pool_group_t *group) {
+    if (!group)
+        return;
+    hal_pool_t *pool = group->pool;
+    pool_worker_t *self = pool_self && pool_self->pool == pool ? pool_self : NULL;
+    unsigned int misses = 0;
+    while (hal_atomic_load64(&group->pending, HAL_MEMORY_ACQUIRE) > 0) {
+        pool_task_t *task = pool_find(pool, self);
+        if (task) {
+            pool_execute(task);
+            misses = 0;
+            continue;
+        }
+        /* Workers keep helping, a sleeping worker could hold the tasks it waits on */
+        if (self || ++misses < HAL_POOL_SPIN) {
+            hal_thrd_yield();
+            continue;
+        }
+        hal_mtx_lock(&group->lock);
+        while (hal_atomic_load64(&group->pending, HAL_MEMORY_ACQUIRE) > 0)
+            hal_cnd_wait(&group->done, &group->lock);
+        hal_mtx_unlock(&group->lock);
+    }
+    /* Let the last finisher leave pool_group_finish */
+    hal_mtx_lock(&group->lock);
+    hal_mtx_unlock(&group->lock);
+}
+
+bool hal_pool_parallel_for(hal_pool_t *pool, size_t begin, size_t end, size_t grain, hal_pool_range_t func, void *userdata) {
+    if (!pool || !func || end < begin)
+        return false;
+    if (begin == end)
+        return true;
+    pool_range_t range = {.func=func, .userdata=userdata, .grain=grain};
+    if (!range.grain && !(range.grain = (end - begin) / ((pool->count + 1) * HAL_POOL_SPLITS)))
+        range.grain = 1;
+
+    hal_pool_group_t group;
+    pool_group_init(&group, pool);
+    pool_task_t *root = pool_task_new(&group, pool_run_range, NULL, &range);
+    if (!root) {
+        pool_group_release(&group);
+        return false;
+    }
+    root->begin = begin;
+    root->end = end;
+    /* The caller takes the first slice itself and helps with the rest */
+    pool_execute(root);
+    hal_pool_wait(&group);
+    pool_group_release(&group);
+    return true;
+}
+
+#endif // HAL_NO_THREADS
@@ -22,6 +22,13 @@
 #include <errno.h>
 #include <unistd.h>
 #include <sched.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
+#if defined(__APPLE__)
+#include <mach/mach_time.h>
+#endif
 
 #define ONCE_FLAG_INIT PTHREAD_ONCE_INIT
 #ifdef INIT_ONCE_STATIC_INIT
@@ -45,6 +52,34 @@ void *impl_thrd_routine(void *p) {
     return (void*)pack.func(pack.arg);
 }
 
+#define HAL_NSEC_PER_SEC 1000000000ull
+
+static uint64_t impl_xtime2nsec(const hal_thrd_timeout *xt) {
+    return (uint64_t)xt->sec * HAL_NSEC_PER_SEC + (uint64_t)xt->nsec;
+}
+
+/* Nanoseconds left until a monotonic deadline */
+static uint64_t impl_remaining(const hal_thrd_timeout *xt) {
+    uint64_t now = hal_time_now_ns(), deadline = impl_xtime2nsec(xt);
+    return deadline > now ? deadline - now : 0;
+}
+
+#if defined(EMULATED_THREADS_USE_NATIVE_TIMEDLOCK)
+/* pthread_mutex_timedlock only takes CLOCK_REALTIME deadlines */
+static struct timespec impl_realtime_deadline(const hal_thrd_timeout *xt) {
+    uint64_t remaining = impl_remaining(xt);
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_sec += (time_t)(remaining / HAL_NSEC_PER_SEC);
+    ts.tv_nsec += (long)(remaining % HAL_NSEC_PER_SEC);
+    if (ts.tv_nsec >= (long)HAL_NSEC_PER_SEC) {
+        ts.tv_sec++;
+        ts.tv_nsec -= (long)HAL_NSEC_PER_SEC;
+    }
+    return ts;
+}
+#endif
+
 bool hal_threads_available(void) {
     return true;
 }
@@ -66,10 +101,17 @@ void hal_cnd_destroy(hal_cnd_t *cond) {
 }
 
 int hal_cnd_init(hal_cnd_t *cond) {
+    pthread_condattr_t attr;
     if (!cond)
         return HAL_THRD_ERROR;
-    pthread_cond_init(&cond->cnd, NULL);
-    return HAL_THRD_SUCCESS;
+    pthread_condattr_init(&attr);
+#if !defined(__APPLE__)
+    /* Timed waits shouldn't move when the wall clock does */
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+#endif
+    int rt = pthread_cond_init(&cond->cnd, &attr);
+    pthread_condattr_destroy(&attr);
+    return rt == 0 ? HAL_THRD_SUCCESS : HAL_THRD_ERROR;
 }
 
 int hal_cnd_signal(hal_cnd_t *cond) {
@@ -84,7 +126,17 @@ int hal_cnd_timedwait(hal_cnd_t *cond, hal_mtx_t *mtx, const hal_thrd_timeout *x
     int rt;
     if (!cond || !mtx || !xt)
         return HAL_THRD_ERROR;
+#if defined(__APPLE__)
+    /* No pthread_condattr_setclock, wait out the remaining time instead */
+    uint64_t remaining = impl_remaining(xt);
+    abs_time.tv_sec = (time_t)(remaining / HAL_NSEC_PER_SEC);
+    abs_time.tv_nsec = (long)(remaining % HAL_NSEC_PER_SEC);
+    rt = pthread_cond_timedwait_relative_np(&cond->cnd, &mtx->mtx, &abs_time);
+#else
+    abs_time.tv_sec = xt->sec;
+    abs_time.tv_nsec = xt->nsec;
     rt = pthread_cond_timedwait(&cond->cnd, &mtx->mtx, &abs_time);
+#endif
     if (rt == ETIMEDOUT)
         return HAL_THRD_BUSY;
     return rt == 0 ? HAL_THRD_SUCCESS : HAL_THRD_ERROR;
@@ -135,23 +187,20 @@ int hal_mtx_timedlock(hal_mtx_t *mtx, const hal_thrd_timeout *xt) {
     if (!mtx || !xt)
         return HAL_THRD_ERROR;
 #ifdef EMULATED_THREADS_USE_NATIVE_TIMEDLOCK
-    struct timespec ts;
-    int rt;
-    ts.tv_sec = xt->sec;
-    ts.tv_nsec = xt->nsec;
-    rt = pthread_mutex_timedlock(&mtx->mtx, &ts);
+    struct timespec ts = impl_realtime_deadline(xt);
+    int rt = pthread_mutex_timedlock(&mtx->mtx, &ts);
     if (rt == 0)
         return HAL_THRD_SUCCESS;
     return rt == ETIMEDOUT ? HAL_THRD_BUSY : HAL_THRD_ERROR;
 #else
-    time_t expire = time(NULL);
-    expire += xt->sec;
+    struct timespec pause = {0, 1000};
     while (hal_mtx_trylock(mtx) != HAL_THRD_SUCCESS) {
-        time_t now = time(NULL);
-        if (expire < now)
+        if (!impl_remaining(xt))
             return HAL_THRD_BUSY;
-        // busy loop!
-        hal_thrd_yield();
+        /* Back off from 1us to 1ms rather than spinning on sched_yield */
+        nanosleep(&pause, NULL);
+        if (pause.tv_nsec < 1000000)
+            pause.tv_nsec *= 2;
     }
     return HAL_THRD_SUCCESS;
 #endif
@@ -170,6 +219,144 @@ int hal_mtx_unlock(hal_mtx_t *mtx) {
     return HAL_THRD_SUCCESS;
 }
 
+#define HAL_RWLOCK(L) ((pthread_rwlock_t*)(L)->rwlock)
+
+void hal_rwlock_destroy(hal_rwlock_t *rwlock) {
+    assert(rwlock);
+    if (!rwlock->rwlock)
+        return;
+    pthread_rwlock_destroy(HAL_RWLOCK(rwlock));
+    free(rwlock->rwlock);
+    rwlock->rwlock = NULL;
+}
+
+int hal_rwlock_init(hal_rwlock_t *rwlock, int type) {
+    pthread_rwlockattr_t attr;
+    if (!rwlock || (type != HAL_RWLOCK_PLAIN && type != HAL_RWLOCK_PREFER_WRITER))
+        return HAL_THRD_ERROR;
+    if (!(rwlock->rwlock = malloc(sizeof(pthread_rwlock_t))))
+        return HAL_THRD_NOMEM;
+    pthread_rwlockattr_init(&attr);
+#if defined(__GLIBC__)
+    /* glibc lets readers overtake waiting writers unless told otherwise */
+    if (type == HAL_RWLOCK_PREFER_WRITER)
+        pthread_rwlockattr_setkind_np(&attr, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+#endif
+    int rt = pthread_rwlock_init(HAL_RWLOCK(rwlock), &attr);
+    pthread_rwlockattr_destroy(&attr);
+    if (rt != 0) {
+        free(rwlock->rwlock);
+        rwlock->rwlock = NULL;
+        return HAL_THRD_ERROR;
+    }
+    return HAL_THRD_SUCCESS;
+}
+
+int hal_rwlock_rdlock(hal_rwlock_t *rwlock) {
+    if (!rwlock || !rwlock->rwlock)
+        return HAL_THRD_ERROR;
+    return pthread_rwlock_rdlock(HAL_RWLOCK(rwlock)) == 0 ? HAL_THRD_SUCCESS : HAL_THRD_ERROR;
+}
+
+int hal_rwlock_tryrdlock(hal_rwlock_t *rwlock) {
+    if (!rwlock || !rwlock->rwlock)
+        return HAL_THRD_ERROR;
+    return pthread_rwlock_tryrdlock(HAL_RWLOCK(rwlock)) == 0 ? HAL_THRD_SUCCESS : HAL_THRD_BUSY;
+}
+
+int hal_rwlock_rdunlock(hal_rwlock_t *rwlock) {
+    if (!rwlock || !rwlock->rwlock)
+        return HAL_THRD_ERROR;
+    return pthread_rwlock_unlock(HAL_RWLOCK(rwlock)) == 0 ? HAL_THRD_SUCCESS : HAL_THRD_ERROR;
+}
+
+int hal_rwlock_wrlock(hal_rwlock_t *rwlock) {
+    if (!rwlock || !rwlock->rwlock)
+        return HAL_THRD_ERROR;
+    return pthread_rwlock_wrlock(HAL_RWLOCK(rwlock)) == 0 ? HAL_THRD_SUCCESS : HAL_THRD_ERROR;
+}
+
+int hal_rwlock_trywrlock(hal_rwlock_t *rwlock) {
+    if (!rwlock || !rwlock->rwlock)
+        return HAL_THRD_ERROR;
+    return pthread_rwlock_trywrlock(HAL_RWLOCK(rwlock)) == 0 ? HAL_THRD_SUCCESS : HAL_THRD_BUSY;
+}
+
+int hal_rwlock_wrunlock(hal_rwlock_t *rwlock) {
+    if (!rwlock || !rwlock->rwlock)
+        return HAL_THRD_ERROR;
+    return pthread_rwlock_unlock(HAL_RWLOCK(rwlock)) == 0 ? HAL_THRD_SUCCESS : HAL_THRD_ERROR;
+}
+
+/* Spins before parking, roughly the cost of a futex round trip */
+#define HAL_LOCK_SPIN 100
+
+#if defined(__linux__)
+static void impl_lock_park(hal_lock_t *lock) {
+    syscall(SYS_futex, &lock->state.value, FUTEX_WAIT_PRIVATE, 2, NULL, NULL, 0);
+}
+
+static void impl_lock_unpark(hal_lock_t *lock) {
+    syscall(SYS_futex, &lock->state.value, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+#else
+/* No futex, park on a condition variable picked by the lock's address */
+#define HAL_LOCK_BUCKETS 64
+
+static struct impl_lock_bucket {
+    pthread_mutex_t mtx;
+    pthread_cond_t cnd;
+} impl_lock_buckets[HAL_LOCK_BUCKETS];
+static pthread_once_t impl_lock_once = PTHREAD_ONCE_INIT;
+
+static void impl_lock_buckets_init(void) {
+    for (int i = 0; i < HAL_LOCK_BUCKETS; i++) {
+        pthread_mutex_init(&impl_lock_buckets[i].mtx, NULL);
+        pthread_cond_init(&impl_lock_buckets[i].cnd, NULL);
+    }
+}
+
+static struct impl_lock_bucket* impl_lock_bucket(hal_lock_t *lock) {
+    pthread_once(&impl_lock_once, impl_lock_buckets_init);
+    return &impl_lock_buckets[((uintptr_t)lock >> 4) % HAL_LOCK_BUCKETS];
+}
+
+static void impl_lock_park(hal_lock_t *lock) {
+    struct impl_lock_bucket *bucket = impl_lock_bucket(lock);
+    pthread_mutex_lock(&bucket->mtx);
+    if (hal_atomic_load32(&lock->state, HAL_MEMORY_RELAXED) == 2)
+        pthread_cond_wait(&bucket->cnd, &bucket->mtx);
+    pthread_mutex_unlock(&bucket->mtx);
+}
+
+/* Buckets are shared between locks, so wake everyone and let them recheck */
+static void impl_lock_unpark(hal_lock_t *lock) {
+    struct impl_lock_bucket *bucket = impl_lock_bucket(lock);
+    pthread_mutex_lock(&bucket->mtx);
+    pthread_cond_broadcast(&bucket->cnd);
+    pthread_mutex_unlock(&bucket->mtx);
+}
+#endif
+
+void hal_lock_lock_slow(hal_lock_t *lock) {
+    for (int i = 0; i < HAL_LOCK_SPIN; i++) {
+        int32_t state = hal_atomic_load32(&lock->state, HAL_MEMORY_RELAXED);
+        if (state == 0 && hal_lock_trylock(lock))
+            return;
+        /* Someone is already parked, spinning won't win */
+        if (state == 2)
+            break;
+        hal_cpu_relax();
+    }
+    /* Mark the lock contended, whoever unlocks it will wake a sleeper */
+    while (hal_atomic_exchange32(&lock->state, 2, HAL_MEMORY_ACQUIRE) != 0)
+        impl_lock_park(lock);
+}
+
+void hal_lock_unlock_slow(hal_lock_t *lock) {
+    impl_lock_unpark(lock);
+}
+
 int hal_thrd_create(hal_thrd_t *thr, thrd_start_t func, void *arg) {
     struct impl_thrd_param *pack;
     if (!thr)
@@ -215,7 +402,9 @@ void hal_thrd_sleep(const hal_thrd_timeout *xt) {
     assert(xt);
     req.tv_sec = xt->sec;
     req.tv_nsec = xt->nsec;
-    nanosleep(&req, NULL);
+    /* Signals cut nanosleep short, sleep for whatever is left */
+    while (nanosleep(&req, &req) == -1 && errno == EINTR)
+        ;
 }
 
 void hal_thrd_yield(void) {
@@ -241,12 +430,57 @@ int hal_tss_set(hal_tss_t key, void *val) {
 }
 
 int hal_timeout(hal_thrd_timeout *xt, int base) {
+    struct timespec ts;
     if (!xt)
         return 0;
-    if (base == TIME_UTC) {
-        xt->sec = time(NULL);
-        xt->nsec = 0;
-        return base;
-    }
-    return 0;
-}
\ No newline at end of file
+    if (base == TIME_UTC)
+        clock_gettime(CLOCK_REALTIME, &ts);
+    else if (base == HAL_TIME_MONOTONIC)
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+    else
+        return 0;
+    xt->sec = ts.tv_sec;
+    xt->nsec = ts.tv_nsec;
+    return base;
+}
+
+int hal_timeout_after(hal_thrd_timeout *xt, uint64_t ns) {
+    if (!xt)
+        return HAL_THRD_ERROR;
+    uint64_t deadline = hal_time_now_ns() + ns;
+    xt->sec = (time_t)(deadline / HAL_NSEC_PER_SEC);
+    xt->nsec = (long)(deadline % HAL_NSEC_PER_SEC);
+    return HAL_THRD_SUCCESS;
+}
+
+uint64_t hal_time_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * HAL_NSEC_PER_SEC + (uint64_t)ts.tv_nsec;
+}
+
+#if defined(__APPLE__)
+static mach_timebase_info_data_t impl_timebase;
+static pthread_once_t impl_timebase_once = PTHREAD_ONCE_INIT;
+
+static void impl_timebase_init(void) {
+    mach_timebase_info(&impl_timebase);
+}
+
+uint64_t hal_time_ticks(void) {
+    return mach_absolute_time();
+}
+
+uint64_t hal_time_frequency(void) {
+    pthread_once(&impl_timebase_once, impl_timebase_init);
+    return HAL_NSEC_PER_SEC * impl_timebase.denom / impl_timebase.numer;
+}
+#else
+uint64_t hal_time_ticks(void) {
+    return hal_time_now_ns();
+}
+
+uint64_t hal_time_frequency(void) {
+    return HAL_NSEC_PER_SEC;
+}
+#endif
\ No newline at end of file
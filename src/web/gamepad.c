@@ -52,12 +52,14 @@ static void add_device(int browser_index, const char *id, int num_buttons, int n
     device->num_buttons = num_buttons;
     device->axis_states = calloc(sizeof(float), device->num_axes);
     device->button_states = calloc(sizeof(bool), device->num_buttons);
+    device->axis_filters = NULL;
     
     hal_gamepad_private_t *priv = malloc(sizeof(hal_gamepad_private_t));
     priv->browser_index = browser_index;
     priv->id = strdup(id);
     device->description = priv->id;
     device->private_data = priv;
+    hal_gamepad_resolve_mapping(device);
     
     devices = realloc(devices, sizeof(hal_gamepad_device_t *) * (num_devices + 1));
     devices[num_devices++] = device;
@@ -87,6 +89,7 @@ static void remove_device(int browser_index) {
     free(priv->id);
     free(priv);
     free(device->axis_states);
+    free(device->axis_filters);
     free(device->button_states);
     free(device);
 }
@@ -116,6 +119,7 @@ void hal_gamepad_init(void) {
     emscripten_set_gamepadconnected_callback(NULL, EM_TRUE, gamepad_connected_callback);
     emscripten_set_gamepaddisconnected_callback(NULL, EM_TRUE, gamepad_disconnected_callback);
     
+    hal_gamepad_mapping_init();
     inited = true;
     hal_gamepad_detect_devices();
 }
@@ -195,7 +199,7 @@ void hal_gamepad_process_events(void) {
         /* Process axes */
         for (int a = 0; a < state.numAxes && a < (int)device->num_axes; a++) {
             float value = (float)state.axis[a];
-            if (value != device->axis_states[a]) {
+            if (value != device->axis_states[a] && hal_gamepad_filter_axis(device, a, &value)) {
                 if (hal_gamepad_axis_cb)
                     hal_gamepad_axis_cb(device, a, value, device->axis_states[a], timestamp, hal_gamepad_axis_ctx);
                 device->axis_states[a] = value;
@@ -216,4 +220,30 @@ void hal_gamepad_process_events(void) {
     }
 }
 
+int hal_gamepad_poll(int timeout_ms) {
+    (void)timeout_ms;
+    return 0;
+}
+
+bool hal_gamepad_get_snapshot(hal_gamepad_device_t *device, hal_gamepad_snapshot_t *snapshot) {
+    /* State is only updated on the thread that processes events */
+    if (!device || !snapshot)
+        return false;
+    hal_gamepad_fill_snapshot(device, snapshot);
+    return true;
+}
+
+size_t hal_gamepad_drain_events(hal_gamepad_event_t *out, size_t max) {
+    /* Input is delivered through callbacks as it arrives */
+    (void)out;
+    (void)max;
+    return 0;
+}
+
+unsigned long long hal_gamepad_dropped_events(hal_gamepad_device_t *device) {
+    /* Events are not held in a bounded queue on this platform */
+    (void)device;
+    return 0;
+}
+
 #endif /* HAL_NO_GAMEPAD */
@@ -16,7 +16,13 @@
  along with this program.  If not, see <https://www.gnu.org/licenses/>. */
 
 #ifndef HAL_NO_FILESYSTEM
+#ifndef HAL_NO_THREADS
+#define HAL_FILESYSTEM_PARALLEL
+#endif
 #include "hal/filesystem.h"
+#ifdef HAL_FILESYSTEM_PARALLEL
+#include "hal/threads.h"
+#endif
 #include <windows.h>
 #include <stdlib.h>
 #include <string.h>
@@ -126,6 +132,24 @@ bool hal_io_flush(hal_file_t file) {
     return FlushFileBuffers((HANDLE)file.fd) != 0;
 }
 
+/* There is no data-only flush in the Win32 API, everything is a full flush */
+bool hal_io_sync(hal_file_t file, hal_io_sync_t mode, uint64_t offset, uint64_t length) {
+    (void)offset;
+    (void)length;
+    if (!hal_io_valid(file))
+        return false;
+    switch (mode) {
+        case HAL_SYNC_NONE:
+            return true;
+        case HAL_SYNC_DATA:
+        case HAL_SYNC_FULL:
+        case HAL_SYNC_RANGE:
+            return FlushFileBuffers((HANDLE)file.fd) != 0;
+        default:
+            return false;
+    }
+}
+
 bool hal_io_valid(hal_file_t file) {
     return file.fd != HAL_INVALID_FILE_HANDLE && file.fd != NULL;
 }
@@ -165,6 +189,74 @@ bool hal_io_truncate(hal_file_t file, long size) {
     return SetEndOfFile((HANDLE)file.fd) != 0;
 }
 
+size_t hal_io_pread(hal_file_t file, void *buffer, size_t size, uint64_t offset) {
+    if (!hal_io_valid(file) || !buffer)
+        return 0;
+    size_t total = 0;
+    while (total < size) {
+        /* The offset in OVERLAPPED replaces the cursor for this call */
+        OVERLAPPED overlapped;
+        memset(&overlapped, 0, sizeof(overlapped));
+        uint64_t position = offset + total;
+        overlapped.Offset = (DWORD)position;
+        overlapped.OffsetHigh = (DWORD)(position >> 32);
+        size_t remaining = size - total;
+        DWORD chunk = remaining > 0x40000000 ? 0x40000000 : (DWORD)remaining;
+        DWORD bytesRead = 0;
+        if (!ReadFile((HANDLE)file.fd, (char*)buffer + total, chunk, &bytesRead, &overlapped) || !bytesRead)
+            break;
+        total += bytesRead;
+    }
+    return total;
+}
+
+size_t hal_io_pwrite(hal_file_t file, const void *buffer, size_t size, uint64_t offset) {
+    if (!hal_io_valid(file) || !buffer)
+        return 0;
+    size_t total = 0;
+    while (total < size) {
+        OVERLAPPED overlapped;
+        memset(&overlapped, 0, sizeof(overlapped));
+        uint64_t position = offset + total;
+        overlapped.Offset = (DWORD)position;
+        overlapped.OffsetHigh = (DWORD)(position >> 32);
+        size_t remaining = size - total;
+        DWORD chunk = remaining > 0x40000000 ? 0x40000000 : (DWORD)remaining;
+        DWORD bytesWritten = 0;
+        if (!WriteFile((HANDLE)file.fd, (const char*)buffer + total, chunk, &bytesWritten, &overlapped) || !bytesWritten)
+            break;
+        total += bytesWritten;
+    }
+    return total;
+}
+
+/* ReadFileScatter/WriteFileGather need unbuffered, page aligned I/O, so loop instead */
+size_t hal_io_readv(hal_file_t file, const hal_io_vec_t *vecs, size_t count) {
+    if (!hal_io_valid(file) || !vecs)
+        return 0;
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++) {
+        size_t result = hal_io_read(file, vecs[i].data, vecs[i].size);
+        total += result;
+        if (result < vecs[i].size)
+            break;
+    }
+    return total;
+}
+
+size_t hal_io_writev(hal_file_t file, const hal_io_vec_t *vecs, size_t count) {
+    if (!hal_io_valid(file) || !vecs)
+        return 0;
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++) {
+        size_t result = hal_io_write(file, vecs[i].data, vecs[i].size);
+        total += result;
+        if (result < vecs[i].size)
+            break;
+    }
+    return total;
+}
+
 /* hal_file_* functions */
 bool hal_file_exists(const char *path) {
     if (!path)
@@ -182,19 +274,30 @@ bool hal_file_delete(const char *path) {
 bool hal_file_rename(const char *old_path, const char *new_path, bool write_over) {
     if (!old_path || !hal_file_exists(old_path) || !new_path)
         return false;
-    if (!write_over && hal_file_exists(new_path))
-        return false;
-    if (write_over && hal_file_exists(new_path))
-        DeleteFileA(new_path);
-    return MoveFileA(old_path, new_path) != 0;
+    /* Same volume is an atomic rename, COPY_ALLOWED handles moving across volumes */
+    DWORD flags = MOVEFILE_COPY_ALLOWED | MOVEFILE_WRITE_THROUGH;
+    if (write_over)
+        flags |= MOVEFILE_REPLACE_EXISTING;
+    return MoveFileExA(old_path, new_path, flags) != 0;
 }
 
 bool hal_file_copy(const char *src_path, const char *dst_path, bool write_over) {
+    return hal_file_copy_ex(src_path, dst_path, write_over, NULL);
+}
+
+bool hal_file_copy_ex(const char *src_path, const char *dst_path, bool write_over, hal_file_copy_method_t *method) {
+    if (method)
+        *method = HAL_FILE_COPY_NONE;
     if (!src_path || !dst_path || !hal_file_exists(src_path))
         return false;
     if (!write_over && hal_path_exists(dst_path))
         return false;
-    return CopyFileA(src_path, dst_path, !write_over) != 0;
+    /* CopyFile already uses block cloning where the filesystem supports it */
+    if (CopyFileA(src_path, dst_path, !write_over) == 0)
+        return false;
+    if (method)
+        *method = HAL_FILE_COPY_SYSTEM;
+    return true;
 }
 
 int hal_file_size(const char *path) {
@@ -228,6 +331,85 @@ BAIL:
     return result;
 }
 
+/* NTFS has no directory fsync, the rename is journaled with the file's metadata */
+bool hal_file_write_atomic(const char *path, const void *data, size_t size) {
+    if (!path || (!data && size))
+        return false;
+    char temp[HAL_MAX_PATH];
+    if (snprintf(temp, sizeof(temp), "%s.%lx%lx", path, GetCurrentProcessId(), GetTickCount()) >= (int)sizeof(temp))
+        return false;
+    hal_file_t file = {.fd=CreateFileA(temp, GENERIC_WRITE, 0, NULL, CREATE_NEW, FILE_ATTRIBUTE_NORMAL, NULL)};
+    if (!hal_io_valid(file))
+        return false;
+    bool result = (!size || hal_io_pwrite(file, data, size, 0) == size) &&
+                  hal_io_sync(file, HAL_SYNC_DATA, 0, 0);
+    result = hal_io_close(&file) && result;
+    if (result && hal_file_rename(temp, path, true))
+        return true;
+    DeleteFileA(temp);
+    return false;
+}
+
+bool hal_file_map(hal_file_map_t *dst, const char *path, hal_file_map_hint_t hint) {
+    if (!dst || !path)
+        return false;
+    dst->data = NULL;
+    dst->size = 0;
+
+    DWORD flags = FILE_ATTRIBUTE_NORMAL;
+    if (hint == HAL_FILE_MAP_SEQUENTIAL)
+        flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+    else if (hint == HAL_FILE_MAP_RANDOM)
+        flags |= FILE_FLAG_RANDOM_ACCESS;
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, flags, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || (unsigned long long)size.QuadPart > (SIZE_T)-1) {
+        CloseHandle(file);
+        return false;
+    }
+    if (size.QuadPart == 0) {
+        CloseHandle(file);
+        return true;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!mapping)
+        return false;
+    /* The view keeps the mapping and file alive until it is unmapped */
+    void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!data)
+        return false;
+
+    if (hint == HAL_FILE_MAP_WILLNEED) {
+        /* PrefetchVirtualMemory is Windows 8+, look it up so older systems still load */
+        typedef struct { PVOID VirtualAddress; SIZE_T NumberOfBytes; } hal_memory_range_entry_t;
+        typedef BOOL (WINAPI *prefetch_fn)(HANDLE, ULONG_PTR, hal_memory_range_entry_t*, ULONG);
+        prefetch_fn prefetch = (prefetch_fn)GetProcAddress(GetModuleHandleA("kernel32.dll"), "PrefetchVirtualMemory");
+        if (prefetch) {
+            hal_memory_range_entry_t range = { data, (SIZE_T)size.QuadPart };
+            prefetch(GetCurrentProcess(), 1, &range, 0);
+        }
+    }
+
+    dst->data = data;
+    dst->size = (size_t)size.QuadPart;
+    return true;
+}
+
+bool hal_file_unmap(hal_file_map_t *map) {
+    if (!map)
+        return false;
+    bool result = !map->data || UnmapViewOfFile(map->data) != 0;
+    map->data = NULL;
+    map->size = 0;
+    return result;
+}
+
 /* hal_directory_* functions */
 bool hal_directory_exists(const char *path) {
     if (!path)
@@ -317,7 +499,25 @@ bool hal_directory_delete(const char *path, bool recursive, bool and_files) {
 }
 
 bool hal_directory_rename(const char *old_path, const char *new_path, bool write_over) {
-    return hal_directory_copy(old_path, new_path, write_over, true);
+    if (!old_path || !new_path || !hal_directory_exists(old_path))
+        return false;
+    if (MoveFileExA(old_path, new_path, MOVEFILE_WRITE_THROUGH))
+        return true;
+    switch (GetLastError()) {
+        case ERROR_NOT_SAME_DEVICE:
+            if (!write_over && hal_path_exists(new_path))
+                return false;
+            break;
+        case ERROR_ALREADY_EXISTS:
+        case ERROR_FILE_EXISTS:
+            /* Directories are never replaced, merge into the existing one */
+            if (!write_over || !hal_directory_exists(new_path))
+                return false;
+            break;
+        default:
+            return false;
+    }
+    return hal_directory_copy_ex(old_path, new_path, write_over, true, NULL);
 }
 
 bool hal_directory_copy(const char *src_path, const char *dst_path, bool write_over, bool delete_src) {
@@ -361,70 +561,687 @@ bool hal_directory_copy(const char *src_path, const char *dst_path, bool write_o
     return result;
 }
 
-int hal_directory_size(const char *path) {
-    if (!path || !hal_directory_exists(path))
-        return -1;
-    hal_dir_t d = {.path = path};
-    const char *name = NULL;
-    bool is_dir = false;
-    int total = 0;
-    while ((name = hal_directory_iter(&d, &is_dir)) != NULL) {
-        const char *full_path = hal_path_join(path, name);
-        if (!full_path) {
-            hal_directory_iter_end(&d);
-            return -1;
+/* Parallel directory copy/delete/stats, same task layout as filesystem_posix.c */
+#define HAL_FS_FILE_BATCH 64
+
+#ifdef HAL_FILESYSTEM_PARALLEL
+typedef hal_atomic64_t hal_fs_counter_t;
+#define fs_load(X) hal_atomic_load64(&(X), HAL_MEMORY_ACQUIRE)
+#define fs_store(X, V) hal_atomic_store64(&(X), V, HAL_MEMORY_RELEASE)
+#define fs_add(X, V) hal_atomic_fetch_add64(&(X), V, HAL_MEMORY_ACQ_REL)
+#define fs_sub(X, V) hal_atomic_fetch_add64(&(X), -(int64_t)(V), HAL_MEMORY_ACQ_REL)
+#define fs_lock(M) hal_mtx_lock(M)
+#define fs_unlock(M) hal_mtx_unlock(M)
+#else
+typedef int64_t hal_fs_counter_t;
+#define fs_load(X) (X)
+#define fs_store(X, V) ((X) = (V))
+#define fs_add(X, V) fs_fetch_add(&(X), (int64_t)(V))
+#define fs_sub(X, V) fs_fetch_add(&(X), -(int64_t)(V))
+#define fs_lock(M) ((void)0)
+#define fs_unlock(M) ((void)0)
+
+static int64_t fs_fetch_add(int64_t *counter, int64_t value) {
+    int64_t previous = *counter;
+    *counter += value;
+    return previous;
+}
+#endif
+
+typedef struct hal_fs_task {
+    char *src;
+    char *dst;                  /* NULL when deleting */
+    char *names;                /* File batch: NUL separated names inside src, NULL for a directory */
+    size_t names_size;
+    size_t num_names;
+    struct hal_fs_task *parent; /* Delete: directory waiting for this task */
+    bool root;                  /* Stats: the caller's directory, failures fail the job */
+    hal_fs_counter_t pending;   /* Delete: outstanding children, plus one for the task itself */
+    struct hal_fs_job *job;
+    struct hal_fs_task *next;   /* Serial: next task on the job's stack */
+} hal_fs_task_t;
+
+typedef struct hal_fs_job {
+    bool write_over;
+    void *context;              /* Extra state for run */
+    void (*run)(struct hal_fs_job *job, hal_fs_task_t *task);
+#ifdef HAL_FILESYSTEM_PARALLEL
+    hal_pool_t *pool;           /* NULL runs every task on the calling thread */
+    hal_pool_group_t *group;
+#endif
+    hal_fs_task_t *stack;
+    hal_fs_counter_t failed;
+} hal_fs_job_t;
+
+static void fs_task_free(hal_fs_task_t *task) {
+    free(task->src);
+    free(task->dst);
+    free(task->names);
+    free(task);
+}
+
+static hal_fs_task_t *fs_task_new(const char *src, const char *dst, hal_fs_task_t *parent) {
+    hal_fs_task_t *task = (hal_fs_task_t*)calloc(1, sizeof(hal_fs_task_t));
+    if (!task)
+        return NULL;
+    task->src = strdup(src);
+    task->dst = dst ? strdup(dst) : NULL;
+    task->parent = parent;
+    fs_store(task->pending, 1);
+    if (!task->src || (dst && !task->dst)) {
+        fs_task_free(task);
+        return NULL;
+    }
+    return task;
+}
+
+static bool fs_task_add_name(hal_fs_task_t *task, const char *name) {
+    size_t length = strlen(name) + 1;
+    char *names = (char*)realloc(task->names, task->names_size + length);
+    if (!names)
+        return false;
+    memcpy(names + task->names_size, name, length);
+    task->names = names;
+    task->names_size += length;
+    task->num_names++;
+    return true;
+}
+
+#ifdef HAL_FILESYSTEM_PARALLEL
+static void fs_task_main(void *userdata) {
+    hal_fs_task_t *task = (hal_fs_task_t*)userdata;
+    task->job->run(task->job, task);
+}
+#endif
+
+static bool fs_push(hal_fs_job_t *job, hal_fs_task_t *task) {
+    task->job = job;
+#ifdef HAL_FILESYSTEM_PARALLEL
+    if (job->pool)
+        return hal_pool_submit(job->pool, job->group, fs_task_main, task);
+#endif
+    /* Serial runs go depth first, like the pool's owner side */
+    task->next = job->stack;
+    job->stack = task;
+    return true;
+}
+
+/* Run root and everything it spawns. threads is 0 for the shared pool, 1 for the
+   calling thread alone, otherwise a pool of that size just for this call */
+static bool fs_run(hal_fs_task_t *root, const hal_directory_options_t *options, bool write_over, void *context,
+                   void (*run)(hal_fs_job_t*, hal_fs_task_t*)) {
+    hal_fs_job_t job;
+    memset(&job, 0, sizeof(job));
+    job.write_over = write_over;
+    job.context = context;
+    job.run = run;
+    fs_store(job.failed, false);
+#ifdef HAL_FILESYSTEM_PARALLEL
+    unsigned int threads = options ? options->threads : 0;
+    hal_pool_t *owned = NULL;
+    if (threads != 1)
+        job.pool = threads ? (owned = hal_pool_create(threads)) : hal_pool_shared();
+    /* Without a pool the tree is still processed, just serially */
+    if (job.pool && !(job.group = hal_pool_group_create(job.pool)))
+        job.pool = NULL;
+#else
+    (void)options;
+#endif
+
+    if (!fs_push(&job, root)) {
+        fs_task_free(root);
+        fs_store(job.failed, true);
+    }
+#ifdef HAL_FILESYSTEM_PARALLEL
+    if (job.pool)
+        hal_pool_wait(job.group);
+    hal_pool_group_destroy(job.group);
+    hal_pool_destroy(owned);
+#endif
+    hal_fs_task_t *task;
+    while ((task = job.stack) != NULL) {
+        job.stack = task->next;
+        run(&job, task);
+    }
+    return !fs_load(job.failed);
+}
+
+/* Copy of dir with room for a separator and any cFileName, paths can outgrow HAL_MAX_PATH */
+static char* fs_path(const char *dir, size_t *length) {
+    *length = strlen(dir);
+    char *path = (char*)malloc(*length + MAX_PATH + 2);
+    if (path)
+        memcpy(path, dir, *length + 1);
+    return path;
+}
+
+static const char* fs_join(char *path, size_t length, const char *name) {
+    path[length] = HAL_PATH_SEPARATOR;
+    strcpy(path + length + 1, name);
+    return path;
+}
+
+static HANDLE fs_find_first(char *path, size_t length, WIN32_FIND_DATAA *data) {
+    memcpy(path + length, "\\*", 3);
+    HANDLE find = FindFirstFileExA(path, FindExInfoBasic, data, FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH);
+    path[length] = '\0';
+    return find;
+}
+
+static bool fs_is_dots(const char *name) {
+    return name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'));
+}
+
+/* Spawn a child task, file batches count as children of the directory they empty */
+static bool fs_spawn(hal_fs_job_t *job, hal_fs_task_t *parent, hal_fs_task_t *task) {
+    if (!task)
+        return false;
+    if (parent && !parent->dst) {
+        task->parent = parent;
+        fs_add(parent->pending, 1);
+    }
+    if (fs_push(job, task))
+        return true;
+    if (parent && !parent->dst)
+        fs_sub(parent->pending, 1);
+    fs_task_free(task);
+    return false;
+}
+
+static void fs_delete_done(hal_fs_job_t *job, hal_fs_task_t *task) {
+    /* Each directory is removed by whichever task finishes with it last */
+    while (task && fs_sub(task->pending, 1) == 1) {
+        hal_fs_task_t *parent = task->parent;
+        if (!task->names && !RemoveDirectoryA(task->src))
+            fs_store(job->failed, true);
+        fs_task_free(task);
+        task = parent;
+    }
+}
+
+static void fs_run_delete(hal_fs_job_t *job, hal_fs_task_t *task) {
+    size_t length;
+    char *path;
+    if (fs_load(job->failed) || !(path = fs_path(task->src, &length))) {
+        fs_store(job->failed, true);
+        fs_delete_done(job, task);
+        return;
+    }
+
+    if (task->names) {
+        /* Batches also hold directory links, those are removed rather than descended */
+        const char *name = task->names;
+        for (size_t i = 0; i < task->num_names; i++, name += strlen(name) + 1)
+            if (!DeleteFileA(fs_join(path, length, name)) && !RemoveDirectoryA(path))
+                fs_store(job->failed, true);
+        free(path);
+        fs_delete_done(job, task);
+        return;
+    }
+
+    WIN32_FIND_DATAA data;
+    HANDLE find = fs_find_first(path, length, &data);
+    if (find == INVALID_HANDLE_VALUE) {
+        fs_store(job->failed, true);
+        free(path);
+        fs_delete_done(job, task);
+        return;
+    }
+    hal_fs_task_t *batch = NULL;
+    do {
+        if (fs_is_dots(data.cFileName))
+            continue;
+        if ((data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) && !(data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)) {
+            if (!fs_spawn(job, task, fs_task_new(fs_join(path, length, data.cFileName), NULL, NULL)))
+                fs_store(job->failed, true);
+            continue;
         }
-        total += is_dir ? hal_directory_size(full_path) : hal_file_size(full_path);
-        free((void*)full_path);
+        if (!batch && !(batch = fs_task_new(task->src, NULL, NULL))) {
+            fs_store(job->failed, true);
+            break;
+        }
+        if (!fs_task_add_name(batch, data.cFileName))
+            fs_store(job->failed, true);
+        if (batch->num_names == HAL_FS_FILE_BATCH) {
+            if (!fs_spawn(job, task, batch))
+                fs_store(job->failed, true);
+            batch = NULL;
+        }
+    } while (FindNextFileA(find, &data));
+    FindClose(find);
+    free(path);
+    if (batch && !fs_spawn(job, task, batch))
+        fs_store(job->failed, true);
+    fs_delete_done(job, task);
+}
+
+static void fs_run_copy(hal_fs_job_t *job, hal_fs_task_t *task) {
+    size_t src_length, dst_length;
+    char *src = NULL, *dst = NULL;
+    if (fs_load(job->failed))
+        goto BAIL;
+    if (!(src = fs_path(task->src, &src_length)) || !(dst = fs_path(task->dst, &dst_length))) {
+        fs_store(job->failed, true);
+        goto BAIL;
     }
-    return total;
+
+    if (task->names) {
+        const char *name = task->names;
+        for (size_t i = 0; i < task->num_names; i++, name += strlen(name) + 1)
+            if (!hal_file_copy_ex(fs_join(src, src_length, name), fs_join(dst, dst_length, name), job->write_over, NULL))
+                fs_store(job->failed, true);
+        goto BAIL;
+    }
+
+    WIN32_FIND_DATAA data;
+    HANDLE find = fs_find_first(src, src_length, &data);
+    if (find == INVALID_HANDLE_VALUE) {
+        fs_store(job->failed, true);
+        goto BAIL;
+    }
+    hal_fs_task_t *batch = NULL;
+    do {
+        if (fs_is_dots(data.cFileName))
+            continue;
+        if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+            fs_join(src, src_length, data.cFileName);
+            fs_join(dst, dst_length, data.cFileName);
+            if ((!CreateDirectoryA(dst, NULL) && (GetLastError() != ERROR_ALREADY_EXISTS || !hal_directory_exists(dst))) ||
+                !fs_spawn(job, NULL, fs_task_new(src, dst, NULL)))
+                fs_store(job->failed, true);
+            continue;
+        }
+        if (!batch && !(batch = fs_task_new(task->src, task->dst, NULL))) {
+            fs_store(job->failed, true);
+            break;
+        }
+        if (!fs_task_add_name(batch, data.cFileName))
+            fs_store(job->failed, true);
+        if (batch->num_names == HAL_FS_FILE_BATCH) {
+            if (!fs_spawn(job, NULL, batch))
+                fs_store(job->failed, true);
+            batch = NULL;
+        }
+    } while (FindNextFileA(find, &data));
+    FindClose(find);
+    if (batch && !fs_spawn(job, NULL, batch))
+        fs_store(job->failed, true);
+BAIL:
+    free(src);
+    free(dst);
+    fs_task_free(task);
 }
 
-int hal_directory_item_count(const char *path, bool recursive) {
+bool hal_directory_copy_ex(const char *src_path, const char *dst_path, bool write_over, bool delete_src, const hal_directory_options_t *options) {
+    if (!src_path || !dst_path || !hal_directory_exists(src_path))
+        return false;
+    if (!hal_directory_create(dst_path, true))
+        return false;
+    hal_fs_task_t *root = fs_task_new(src_path, dst_path, NULL);
+    if (!root)
+        return false;
+    if (!fs_run(root, options, write_over, NULL, fs_run_copy))
+        return false;
+    return !delete_src || hal_directory_delete_ex(src_path, true, true, options);
+}
+
+bool hal_directory_delete_ex(const char *path, bool recursive, bool and_files, const hal_directory_options_t *options) {
+    if (!recursive)
+        return hal_directory_delete(path, false, and_files);
     if (!path || !hal_directory_exists(path))
+        return false;
+    hal_fs_task_t *root = fs_task_new(path, NULL, NULL);
+    if (!root)
+        return false;
+    return fs_run(root, options, false, NULL, fs_run_delete);
+}
+
+/* Directory walker */
+typedef struct hal_walker {
+    int flags;
+    hal_walk_entry_callback callback;
+    void *userdata;
+    char *path;
+    size_t path_length, path_capacity;
+    size_t name_length;
+} hal_walker_t;
+
+static int64_t walk_unix_time(FILETIME time) {
+    ULARGE_INTEGER value;
+    value.LowPart = time.dwLowDateTime;
+    value.HighPart = time.dwHighDateTime;
+    return (int64_t)(value.QuadPart / 10000000ULL) - 11644473600LL;
+}
+
+static hal_path_type_t walk_type_from_attributes(DWORD attributes, bool follow) {
+    if ((attributes & FILE_ATTRIBUTE_REPARSE_POINT) && !follow)
+        return HAL_PATH_SYMLINK;
+    if (attributes & FILE_ATTRIBUTE_DIRECTORY)
+        return HAL_PATH_DIRECTORY;
+    if (attributes & FILE_ATTRIBUTE_DEVICE)
+        return HAL_PATH_OTHER;
+    return HAL_PATH_FILE;
+}
+
+bool hal_path_stat(const char *path, hal_path_stat_t *dst, bool follow_links) {
+    if (!path || !dst)
+        return false;
+    DWORD flags = FILE_FLAG_BACKUP_SEMANTICS | (follow_links ? 0 : FILE_FLAG_OPEN_REPARSE_POINT);
+    HANDLE handle = CreateFileA(path, FILE_READ_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                NULL, OPEN_EXISTING, flags, NULL);
+    if (handle == INVALID_HANDLE_VALUE)
+        return false;
+    BY_HANDLE_FILE_INFORMATION info;
+    BOOL ok = GetFileInformationByHandle(handle, &info);
+    CloseHandle(handle);
+    if (!ok)
+        return false;
+    dst->type = walk_type_from_attributes(info.dwFileAttributes, follow_links);
+    dst->size = ((uint64_t)info.nFileSizeHigh << 32) | info.nFileSizeLow;
+    dst->blocks = (dst->size + 511) / 512;
+    dst->device = info.dwVolumeSerialNumber;
+    dst->inode = ((uint64_t)info.nFileIndexHigh << 32) | info.nFileIndexLow;
+    dst->links = info.nNumberOfLinks;
+    dst->mode = info.dwFileAttributes & FILE_ATTRIBUTE_READONLY ? 0444 : 0666;
+    dst->modified = walk_unix_time(info.ftLastWriteTime);
+    return true;
+}
+
+static bool walk_reserve(hal_walker_t *walker, size_t length) {
+    if (length <= walker->path_capacity)
+        return true;
+    size_t capacity = walker->path_capacity ? walker->path_capacity : 256;
+    while (capacity < length)
+        capacity *= 2;
+    char *path = (char*)realloc(walker->path, capacity);
+    if (!path)
+        return false;
+    walker->path = path;
+    walker->path_capacity = capacity;
+    return true;
+}
+
+const char* hal_walk_entry_path(hal_walk_entry_t *entry) {
+    if (!entry || !entry->walker)
+        return NULL;
+    hal_walker_t *walker = (hal_walker_t*)entry->walker;
+    if (!walk_reserve(walker, walker->path_length + walker->name_length + 2))
+        return NULL;
+    walker->path[walker->path_length] = HAL_PATH_SEPARATOR;
+    memcpy(walker->path + walker->path_length + 1, entry->name, walker->name_length + 1);
+    return walker->path;
+}
+
+const char* hal_walk_entry_dir(hal_walk_entry_t *entry) {
+    if (!entry || !entry->walker)
+        return NULL;
+    hal_walker_t *walker = (hal_walker_t*)entry->walker;
+    walker->path[walker->path_length] = '\0';
+    return walker->path;
+}
+
+const hal_path_stat_t* hal_walk_entry_stat(hal_walk_entry_t *entry) {
+    /* FindFirstFileEx already returned everything but the file index */
+    return entry && entry->has_stat ? &entry->stat : NULL;
+}
+
+static int walk_directory(hal_walker_t *walker, size_t depth) {
+    if (!walk_reserve(walker, walker->path_length + 3))
         return -1;
-    hal_dir_t d = {.path = path};
-    const char *name = NULL;
-    bool is_dir = false;
-    int total = 0;
-    while ((name = hal_directory_iter(&d, &is_dir)) != NULL) {
-        total++;
-        if (is_dir && recursive) {
-            const char *full_path = hal_path_join(path, name);
-            if (!full_path) {
-                hal_directory_iter_end(&d);
-                return -1;
-            }
-            total += hal_directory_item_count(full_path, true);
-            free((void*)full_path);
+    memcpy(walker->path + walker->path_length, "\\*", 3);
+    WIN32_FIND_DATAA data;
+    HANDLE find = FindFirstFileExA(walker->path, FindExInfoBasic, &data, FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH);
+    walker->path[walker->path_length] = '\0';
+    if (find == INVALID_HANDLE_VALUE)
+        return depth ? HAL_WALK_CONTINUE : -1;
+
+    int result = HAL_WALK_CONTINUE;
+    bool follow = walker->flags & HAL_WALK_FOLLOW_LINKS;
+    do {
+        const char *name = data.cFileName;
+        if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0')))
+            continue;
+        hal_walk_entry_t entry = {
+            .name = name,
+            .depth = depth,
+            .type = walk_type_from_attributes(data.dwFileAttributes, follow),
+            .has_stat = true,
+            .walker = walker
+        };
+        entry.stat.type = entry.type;
+        entry.stat.size = ((uint64_t)data.nFileSizeHigh << 32) | data.nFileSizeLow;
+        entry.stat.blocks = (entry.stat.size + 511) / 512;
+        entry.stat.links = 1;
+        entry.stat.mode = data.dwFileAttributes & FILE_ATTRIBUTE_READONLY ? 0444 : 0666;
+        entry.stat.modified = walk_unix_time(data.ftLastWriteTime);
+        walker->name_length = strlen(name);
+
+        bool is_dir = entry.type == HAL_PATH_DIRECTORY;
+        int action = HAL_WALK_CONTINUE;
+        if (!is_dir || (walker->flags & HAL_WALK_DIRECTORIES))
+            action = walker->callback(&entry, walker->userdata);
+        if (action != HAL_WALK_CONTINUE && action != HAL_WALK_SKIP) {
+            result = HAL_WALK_STOP;
+            break;
         }
-    }
-    return total;
+        if (!is_dir || action == HAL_WALK_SKIP || !(walker->flags & HAL_WALK_RECURSIVE))
+            continue;
+
+        size_t saved = walker->path_length;
+        if (!walk_reserve(walker, saved + walker->name_length + 2)) {
+            result = -1;
+            break;
+        }
+        walker->path[saved] = HAL_PATH_SEPARATOR;
+        memcpy(walker->path + saved + 1, name, walker->name_length + 1);
+        walker->path_length = saved + 1 + walker->name_length;
+        result = walk_directory(walker, depth + 1);
+        walker->path_length = saved;
+        walker->path[saved] = '\0';
+        if (result != HAL_WALK_CONTINUE)
+            break;
+    } while (FindNextFileA(find, &data));
+    FindClose(find);
+    return result;
+}
+
+bool hal_path_walk_ex(const char *path, int flags, hal_walk_entry_callback callback, void *userdata) {
+    if (!path || !callback || !hal_directory_exists(path))
+        return false;
+
+    hal_walker_t walker;
+    memset(&walker, 0, sizeof(walker));
+    walker.flags = flags;
+    walker.callback = callback;
+    walker.userdata = userdata;
+    size_t length = strlen(path);
+    while (length > 1 && (path[length - 1] == '\\' || path[length - 1] == '/'))
+        length--;
+    if (!walk_reserve(&walker, length + 1))
+        return false;
+    memcpy(walker.path, path, length);
+    walker.path[length] = '\0';
+    walker.path_length = length;
+
+    int result = walk_directory(&walker, 0);
+    free(walker.path);
+    return result == HAL_WALK_CONTINUE;
+}
+
+/* Same totals as the old hal_directory_iter loop: every entry that isn't a
+   directory adds its size, and linked directories are descended */
+static int walk_size(hal_walk_entry_t *entry, void *userdata) {
+    if (entry->type != HAL_PATH_DIRECTORY)
+        *(int*)userdata += (int)entry->stat.size;
+    return HAL_WALK_CONTINUE;
+}
+
+static int walk_count(hal_walk_entry_t *entry, void *userdata) {
+    (void)entry;
+    (*(int*)userdata)++;
+    return HAL_WALK_CONTINUE;
+}
+
+int hal_directory_size(const char *path) {
+    int total = 0;
+    return hal_path_walk_ex(path, HAL_WALK_RECURSIVE | HAL_WALK_FOLLOW_LINKS, walk_size, &total) ? total : -1;
+}
+
+int hal_directory_item_count(const char *path, bool recursive) {
+    int total = 0;
+    int flags = HAL_WALK_DIRECTORIES | (recursive ? HAL_WALK_RECURSIVE : 0);
+    return hal_path_walk_ex(path, flags, walk_count, &total) ? total : -1;
 }
 
 int hal_directory_file_count(const char *path, bool recursive) {
-    if (!path || !hal_directory_exists(path))
-        return -1;
-    hal_dir_t d = {.path = path};
-    const char *name = NULL;
-    bool is_dir = false;
     int total = 0;
-    while ((name = hal_directory_iter(&d, &is_dir)) != NULL) {
-        if (is_dir) {
-            if (recursive) {
-                const char *full_path = hal_path_join(path, name);
-                if (!full_path) {
-                    hal_directory_iter_end(&d);
-                    return -1;
-                }
-                total += hal_directory_file_count(full_path, true);
-                free((void*)full_path);
-            }
-        } else {
-            total++;
-        }
+    return hal_path_walk_ex(path, recursive ? HAL_WALK_RECURSIVE : 0, walk_count, &total) ? total : -1;
+}
+
+/* Directory statistics */
+typedef struct hal_inode_slot {
+    uint64_t device, inode;
+    bool used;
+} hal_inode_slot_t;
+
+/* (volume, file index) pairs of multiply linked files already counted */
+typedef struct hal_inode_set {
+#ifdef HAL_FILESYSTEM_PARALLEL
+    hal_mtx_t lock;
+#endif
+    hal_inode_slot_t *slots;
+    size_t count, capacity;
+} hal_inode_set_t;
+
+typedef struct hal_stats_context {
+    hal_fs_counter_t bytes, blocks, files, directories;
+    hal_inode_set_t *links;
+} hal_stats_context_t;
+
+static size_t inode_hash(uint64_t device, uint64_t inode) {
+    uint64_t x = inode ^ (device * 0x9E3779B97F4A7C15ULL);
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return (size_t)(x ^ (x >> 31));
+}
+
+static bool inode_set_place(hal_inode_slot_t *slots, size_t capacity, uint64_t device, uint64_t inode) {
+    size_t i = inode_hash(device, inode) & (capacity - 1);
+    for (; slots[i].used; i = (i + 1) & (capacity - 1))
+        if (slots[i].device == device && slots[i].inode == inode)
+            return false;
+    slots[i].device = device;
+    slots[i].inode = inode;
+    slots[i].used = true;
+    return true;
+}
+
+/* Returns true the first time a file is seen, allocation failures count as unseen */
+static bool inode_set_insert(hal_inode_set_t *set, uint64_t device, uint64_t inode) {
+    bool inserted = true;
+    fs_lock(&set->lock);
+    if ((set->count + 1) * 2 > set->capacity) {
+        size_t capacity = set->capacity ? set->capacity * 2 : 256;
+        hal_inode_slot_t *slots = (hal_inode_slot_t*)calloc(capacity, sizeof(hal_inode_slot_t));
+        if (!slots)
+            goto BAIL;
+        for (size_t i = 0; i < set->capacity; i++)
+            if (set->slots[i].used)
+                inode_set_place(slots, capacity, set->slots[i].device, set->slots[i].inode);
+        free(set->slots);
+        set->slots = slots;
+        set->capacity = capacity;
     }
-    return total;
+    if ((inserted = inode_set_place(set->slots, set->capacity, device, inode)))
+        set->count++;
+BAIL:
+    fs_unlock(&set->lock);
+    return inserted;
+}
+
+static void fs_run_stats(hal_fs_job_t *job, hal_fs_task_t *task) {
+    hal_stats_context_t *context = (hal_stats_context_t*)job->context;
+    size_t length;
+    char *path = fs_path(task->src, &length);
+    WIN32_FIND_DATAA data;
+    HANDLE find = path ? fs_find_first(path, length, &data) : INVALID_HANDLE_VALUE;
+    if (find == INVALID_HANDLE_VALUE) {
+        /* Unreadable subdirectories are skipped, same as hal_path_walk_ex */
+        if (task->root || !path)
+            fs_store(job->failed, true);
+        free(path);
+        fs_task_free(task);
+        return;
+    }
+
+    hal_directory_stats_t local;
+    memset(&local, 0, sizeof(local));
+    do {
+        if (fs_is_dots(data.cFileName))
+            continue;
+        fs_join(path, length, data.cFileName);
+        hal_path_type_t type = walk_type_from_attributes(data.dwFileAttributes, false);
+        if (type == HAL_PATH_DIRECTORY) {
+            local.directories++;
+            if (!fs_spawn(job, NULL, fs_task_new(path, NULL, NULL)))
+                fs_store(job->failed, true);
+            continue;
+        }
+        uint64_t size = ((uint64_t)data.nFileSizeHigh << 32) | data.nFileSizeLow;
+        if (context->links && type == HAL_PATH_FILE) {
+            /* FindFirstFileEx doesn't report link counts, ask the file itself */
+            hal_path_stat_t st;
+            if (hal_path_stat(path, &st, false) && st.links > 1 && !inode_set_insert(context->links, st.device, st.inode))
+                continue;
+        }
+        local.files++;
+        local.blocks += (size + 511) / 512;
+        if (type == HAL_PATH_FILE)
+            local.bytes += size;
+    } while (FindNextFileA(find, &data));
+    FindClose(find);
+    free(path);
+    fs_add(context->bytes, (int64_t)local.bytes);
+    fs_add(context->blocks, (int64_t)local.blocks);
+    fs_add(context->files, (int64_t)local.files);
+    fs_add(context->directories, (int64_t)local.directories);
+    fs_task_free(task);
+}
+
+bool hal_directory_stats(const char *path, hal_directory_stats_t *dst, bool dedup_links, const hal_directory_options_t *options) {
+    if (!path || !dst || !hal_directory_exists(path))
+        return false;
+    size_t length = strlen(path);
+    while (length > 1 && (path[length - 1] == '\\' || path[length - 1] == '/'))
+        length--;
+    char *root_path = (char*)malloc(length + 1);
+    if (!root_path)
+        return false;
+    memcpy(root_path, path, length);
+    root_path[length] = '\0';
+    hal_inode_set_t links;
+    memset(&links, 0, sizeof(links));
+    hal_stats_context_t context;
+    memset(&context, 0, sizeof(context));
+    context.links = dedup_links ? &links : NULL;
+#ifdef HAL_FILESYSTEM_PARALLEL
+    hal_mtx_init(&links.lock, HAL_MTX_PLAIN);
+#endif
+
+    hal_fs_task_t *root = fs_task_new(root_path, NULL, NULL);
+    free(root_path);
+    if (root)
+        root->root = true;
+    bool result = root && fs_run(root, options, false, &context, fs_run_stats);
+    dst->bytes = (uint64_t)fs_load(context.bytes);
+    dst->blocks = (uint64_t)fs_load(context.blocks);
+    dst->files = (uint64_t)fs_load(context.files);
+    dst->directories = (uint64_t)fs_load(context.directories);
+#ifdef HAL_FILESYSTEM_PARALLEL
+    hal_mtx_destroy(&links.lock);
+#endif
+    free(links.slots);
+    return result;
 }
 
 /* Directory iteration */
@@ -721,201 +1538,22 @@ BAIL:
     return parts;
 }
 
-/* Glob functions */
-static int simple_match(const char *pat, const char *s) {
-    if (!pat)
-        return s && *s == '\0';
-    if (*pat == '\0')
-        return *s == '\0';
-    if (*pat == '*') {
-        while (*(pat + 1) == '*')
-            pat++;
-        if (*(pat+1) == '\0') return 1;
-        for (const char *p = s; *p; ++p)
-            if (simple_match(pat + 1, p))
-                return 1;
-        return 0;
-    } else if (*pat == '?') {
-        return *s && simple_match(pat+1, s+1);
-    } else {
-        if (*pat == *s)
-            return simple_match(pat + 1, s + 1);
-        return 0;
-    }
-}
-
-struct collect_ctx {
-    char **out;
-    int n;
-    int cap;
-};
-
-static void collect_add(struct collect_ctx *c, const char *full) {
-    if (c->n >= c->cap) {
-        int newcap = c->cap == 0 ? 8 : c->cap * 2;
-        char **tmp = (char **)realloc(c->out, newcap * sizeof(char*));
-        if (!tmp)
-            return;
-        c->out = tmp;
-        c->cap = newcap;
-    }
-    c->out[c->n++] = strdup(full);
-}
-
-static void walk_and_match(const char *base, const char *suffix_pat, struct collect_ctx *c) {
-    char pattern[HAL_MAX_PATH];
-    snprintf(pattern, sizeof(pattern), "%s\\*", base);
-    
-    WIN32_FIND_DATAA fd;
-    HANDLE hFind = FindFirstFileA(pattern, &fd);
-    if (hFind == INVALID_HANDLE_VALUE)
-        return;
-    
-    do {
-        if (strcmp(fd.cFileName, ".") == 0 || strcmp(fd.cFileName, "..") == 0)
-            continue;
-        char full[HAL_MAX_PATH];
-        snprintf(full, sizeof(full), "%s\\%s", base, fd.cFileName);
-        if (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
-            walk_and_match(full, suffix_pat, c);
-        else if (simple_match(suffix_pat, fd.cFileName))
-            collect_add(c, full);
-    } while (FindNextFileA(hFind, &fd));
-    
-    FindClose(hFind);
-}
-
-const char** hal_directory_glob(const char *pattern, int *count) {
-    if (!pattern) return NULL;
-    struct collect_ctx c = {0};
-    const char *ddstar = strstr(pattern, "**");
-    if (ddstar) {
-        const char *slash_before = ddstar;
-        while (slash_before > pattern && *slash_before != '\\' && *slash_before != '/')
-            --slash_before;
-        size_t base_len = 0;
-        const char *suffix_pat = NULL;
-        if (*slash_before == '\\' || *slash_before == '/') {
-            base_len = slash_before - pattern;
-            suffix_pat = ddstar + 2;
-            if (*suffix_pat == '\\' || *suffix_pat == '/')
-                suffix_pat++;
-        } else {
-            base_len = 0;
-            suffix_pat = ddstar + 2;
-            if (*suffix_pat == '\\' || *suffix_pat == '/')
-                suffix_pat++;
-        }
-        char base[HAL_MAX_PATH];
-        if (base_len == 0)
-            strcpy(base, ".");
-        else {
-            strncpy(base, pattern, base_len);
-            base[base_len] = '\0';
-        }
-        walk_and_match(base, suffix_pat, &c);
-    } else {
-        const char *last = strrchr(pattern, '\\');
-        const char *flast = strrchr(pattern, '/');
-        if (flast && (!last || flast > last))
-            last = flast;
-        char dir[HAL_MAX_PATH];
-        const char *filepat = NULL;
-        if (last) {
-            size_t dlen = last - pattern;
-            if (dlen == 0)
-                strcpy(dir, "\\");
-            else {
-                strncpy(dir, pattern, dlen);
-                dir[dlen] = '\0';
-            }
-            filepat = last + 1;
-        } else { strcpy(dir, "."); filepat = pattern; }
-        
-        char search[HAL_MAX_PATH];
-        snprintf(search, sizeof(search), "%s\\*", dir);
-        WIN32_FIND_DATAA fd;
-        HANDLE hFind = FindFirstFileA(search, &fd);
-        if (hFind != INVALID_HANDLE_VALUE) {
-            do {
-                if (strcmp(fd.cFileName, ".") == 0 || strcmp(fd.cFileName, "..") == 0) continue;
-                char full[HAL_MAX_PATH];
-                snprintf(full, sizeof(full), "%s\\%s", dir, fd.cFileName);
-                if (!(fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
-                    if (simple_match(filepat, fd.cFileName))
-                        collect_add(&c, full);
-                } else {
-                    walk_and_match(full, filepat, &c);
-                }
-            } while (FindNextFileA(hFind, &fd));
-            FindClose(hFind);
-        }
-    }
-    if (count)
-        *count = c.n;
-    if (c.n == 0)
-        return NULL;
-    char **out = (char **)realloc(c.out, c.n * sizeof(char *));
-    if (out)
-        c.out = out;
-    return (const char**)c.out;
-}
+/* hal_path_walk */
+typedef struct hal_walk_legacy {
+    hal_walk_callback callback;
+    void *userdata;
+} hal_walk_legacy_t;
 
-bool hal_path_glob(const char *pattern, hal_glob_callback callback, void *userdata) {
-    if (!pattern || !callback)
-        return false;
-    
-    int count = 0;
-    const char **matches = hal_directory_glob(pattern, &count);
-    if (!matches)
-        return true;
-    
-    bool result = true;
-    for (int i = 0; i < count; i++) {
-        const char *filename = hal_path_filename(matches[i]);
-        const char *dirname = hal_path_dirname(matches[i]);
-        if (callback(dirname ? dirname : ".", filename, userdata) != 0) {
-            result = false;
-        }
-        if (dirname)
-            free((void*)dirname);
-        free((void*)matches[i]);
-    }
-    free(matches);
-    return result;
+static int walk_legacy(hal_walk_entry_t *entry, void *userdata) {
+    hal_walk_legacy_t *legacy = (hal_walk_legacy_t*)userdata;
+    return legacy->callback(hal_walk_entry_dir(entry), entry->name, legacy->userdata) != 0 ? HAL_WALK_STOP : HAL_WALK_CONTINUE;
 }
 
 bool hal_path_walk(const char *path, bool recursive, hal_walk_callback callback, void *userdata) {
-    if (!path || !hal_directory_exists(path) || !callback)
+    if (!callback)
         return false;
-    
-    hal_dir_t d = {.path = path};
-    const char *name = NULL;
-    bool is_dir = false;
-    
-    while ((name = hal_directory_iter(&d, &is_dir)) != NULL) {
-        const char *full_path = hal_path_join(path, name);
-        if (!full_path)
-            continue;
-        
-        if (is_dir) {
-            if (recursive) {
-                if (!hal_path_walk(full_path, recursive, callback, userdata)) {
-                    free((void*)full_path);
-                    hal_directory_iter_end(&d);
-                    return false;
-                }
-            }
-        } else {
-            if (callback(path, name, userdata) != 0) {
-                free((void*)full_path);
-                hal_directory_iter_end(&d);
-                return false;
-            }
-        }
-        free((void*)full_path);
-    }
-    return true;
+    hal_walk_legacy_t legacy = {.callback = callback, .userdata = userdata};
+    return hal_path_walk_ex(path, recursive ? HAL_WALK_RECURSIVE : 0, walk_legacy, &legacy);
 }
 
 #endif /* HAL_NO_FILESYSTEM */
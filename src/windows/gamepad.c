@@ -142,6 +142,7 @@ static void dispose_device(hal_gamepad_device_t *device) {
     }
     free(priv);
     free(device->axis_states);
+    free(device->axis_filters);
     free(device->button_states);
     free(device);
 }
@@ -156,12 +157,14 @@ static hal_gamepad_device_t *create_xinput_device(unsigned int player_index) {
     device->num_buttons = 15;
     device->axis_states = calloc(sizeof(float), device->num_axes);
     device->button_states = calloc(sizeof(bool), device->num_buttons);
+    device->axis_filters = NULL;
     
     hal_gamepad_private_t *priv = malloc(sizeof(hal_gamepad_private_t));
     memset(priv, 0, sizeof(hal_gamepad_private_t));
     priv->is_xinput = true;
     priv->player_index = player_index;
     device->private_data = priv;
+    hal_gamepad_resolve_mapping(device);
     
     return device;
 }
@@ -200,7 +203,7 @@ static void poll_xinput(void) {
                 };
                 
                 for (unsigned int a = 0; a < 6; a++) {
-                    if (new_axes[a] != device->axis_states[a]) {
+                    if (new_axes[a] != device->axis_states[a] && hal_gamepad_filter_axis(device, a, &new_axes[a])) {
                         queue_axis_event(device, timestamp, a, new_axes[a], device->axis_states[a]);
                         device->axis_states[a] = new_axes[a];
                     }
@@ -284,6 +287,7 @@ void hal_gamepad_init(void) {
             direct_input_interface = NULL;
     }
 
+    hal_gamepad_mapping_init();
     inited = true;
     hal_gamepad_detect_devices();
 }
@@ -391,4 +395,32 @@ void hal_gamepad_process_events(void) {
     in_process_events = false;
 }
 
+int hal_gamepad_poll(int timeout_ms) {
+    (void)timeout_ms;
+    return 0;
+}
+
+bool hal_gamepad_get_snapshot(hal_gamepad_device_t *device, hal_gamepad_snapshot_t *snapshot) {
+    /* State is only updated on the thread that processes events */
+    if (!device || !snapshot)
+        return false;
+    hal_gamepad_fill_snapshot(device, snapshot);
+    return true;
+}
+
+size_t hal_gamepad_drain_events(hal_gamepad_event_t *out, size_t max) {
+    if (!inited || out == NULL)
+        return 0;
+
+    if (xinput_available)
+        poll_xinput();
+    return hal_gamepad_drain_queued_events(event_queue, &event_count, out, max);
+}
+
+unsigned long long hal_gamepad_dropped_events(hal_gamepad_device_t *device) {
+    /* Events are not held in a bounded queue on this platform */
+    (void)device;
+    return 0;
+}
+
 #endif /* HAL_NO_GAMEPAD */
@@ -19,6 +19,7 @@
 #include "hal/threads.h"
 #include <windows.h>
 #include <time.h>
+#include <assert.h>
 
 static void impl_tss_dtor_invoke();  // forward decl.
 
@@ -41,6 +42,18 @@ static DWORD impl_xtime2msec(const hal_thrd_timeout *xt) {
     return (DWORD)((xt->sec * 1000u) + (xt->nsec / 1000000));
 }
 
+#define HAL_NSEC_PER_SEC 1000000000ull
+
+/* Milliseconds left until a monotonic deadline, rounded up so waits never return early */
+static DWORD impl_deadline2msec(const hal_thrd_timeout *xt) {
+    uint64_t now = hal_time_now_ns();
+    uint64_t deadline = (uint64_t)xt->sec * HAL_NSEC_PER_SEC + (uint64_t)xt->nsec;
+    if (deadline <= now)
+        return 0;
+    uint64_t msec = (deadline - now + 999999) / 1000000;
+    return msec >= INFINITE ? INFINITE - 1 : (DWORD)msec;
+}
+
 #ifdef EMULATED_THREADS_USE_NATIVE_CALL_ONCE
 struct impl_call_once_param { void (*func)(void); };
 
@@ -106,9 +119,9 @@ static int impl_cond_do_wait(hal_cnd_t *cond, hal_mtx_t *mtx, const hal_thrd_tim
     cond->blocked++;
     ReleaseSemaphore(cond->sem_gate, 1, NULL);
 
-    mtx_unlock(mtx);
+    hal_mtx_unlock(mtx);
 
-    w = WaitForSingleObject(cond->sem_queue, xt ? impl_xtime2msec(xt) : INFINITE);
+    w = WaitForSingleObject(cond->sem_queue, xt ? impl_deadline2msec(xt) : INFINITE);
     timeout = (w == WAIT_TIMEOUT);
 
     EnterCriticalSection(&cond->monitor);
@@ -141,7 +154,7 @@ static int impl_cond_do_wait(hal_cnd_t *cond, hal_mtx_t *mtx, const hal_thrd_tim
         ReleaseSemaphore(cond->sem_gate, 1, NULL);
     }
 
-    mtx_lock(mtx);
+    hal_mtx_lock(mtx);
     return timeout ? HAL_THRD_BUSY : HAL_THRD_SUCCESS;
 }
 #endif  // ifndef EMULATED_THREADS_USE_NATIVE_CV
@@ -191,7 +204,7 @@ void hal_call_once(hal_once_flag *flag, void (*func)(void)) {
         InterlockedExchange(&flag->status, 2);
     } else {
         while (flag->status == 1)
-            thrd_yield(); // busy loop!
+            hal_thrd_yield(); // busy loop!
     }
 #endif
 }
@@ -250,7 +263,7 @@ int hal_cnd_timedwait(hal_cnd_t *cond, hal_mtx_t *mtx, const hal_thrd_timeout *x
     if (!cond || !mtx || !xt)
         return HAL_THRD_ERROR;
 #ifdef EMULATED_THREADS_USE_NATIVE_CV
-    if (SleepConditionVariableCS(&cond->condvar, &mtx->cs, impl_xtime2msec(xt)))
+    if (SleepConditionVariableCS(&cond->condvar, &mtx->cs, impl_deadline2msec(xt)))
         return HAL_THRD_SUCCESS;
     return (GetLastError() == ERROR_TIMEOUT) ? HAL_THRD_BUSY : HAL_THRD_ERROR;
 #else
@@ -294,17 +307,16 @@ int hal_mtx_lock(hal_mtx_t *mtx) {
 }
 
 int hal_mtx_timedlock(hal_mtx_t *mtx, const hal_thrd_timeout *xt) {
-    time_t expire, now;
+    int spins = 0;
     if (!mtx || !xt)
         return HAL_THRD_ERROR;
-    expire = time(NULL);
-    expire += xt->sec;
-    while (HAL_MTX_TRYlock(mtx) != HAL_THRD_SUCCESS) {
-        now = time(NULL);
-        if (expire < now)
+    while (!TryEnterCriticalSection(&mtx->cs)) {
+        if (!impl_deadline2msec(xt))
             return HAL_THRD_BUSY;
-        // busy loop!
-        thrd_yield();
+        if (++spins < 64)
+            SwitchToThread();
+        else
+            Sleep(1);
     }
     return HAL_THRD_SUCCESS;
 }
@@ -322,6 +334,135 @@ int hal_mtx_unlock(hal_mtx_t *mtx) {
     return HAL_THRD_SUCCESS;
 }
 
+#if _WIN32_WINNT >= 0x0600
+void hal_rwlock_destroy(hal_rwlock_t *rwlock) {
+    assert(rwlock);
+    /* SRWLOCKs hold no resources */
+}
+
+int hal_rwlock_init(hal_rwlock_t *rwlock, int type) {
+    if (!rwlock || (type != HAL_RWLOCK_PLAIN && type != HAL_RWLOCK_PREFER_WRITER))
+        return HAL_THRD_ERROR;
+    InitializeSRWLock(&rwlock->srw);
+    return HAL_THRD_SUCCESS;
+}
+
+int hal_rwlock_rdlock(hal_rwlock_t *rwlock) {
+    if (!rwlock)
+        return HAL_THRD_ERROR;
+    AcquireSRWLockShared(&rwlock->srw);
+    return HAL_THRD_SUCCESS;
+}
+
+int hal_rwlock_tryrdlock(hal_rwlock_t *rwlock) {
+    if (!rwlock)
+        return HAL_THRD_ERROR;
+    return TryAcquireSRWLockShared(&rwlock->srw) ? HAL_THRD_SUCCESS : HAL_THRD_BUSY;
+}
+
+int hal_rwlock_rdunlock(hal_rwlock_t *rwlock) {
+    if (!rwlock)
+        return HAL_THRD_ERROR;
+    ReleaseSRWLockShared(&rwlock->srw);
+    return HAL_THRD_SUCCESS;
+}
+
+int hal_rwlock_wrlock(hal_rwlock_t *rwlock) {
+    if (!rwlock)
+        return HAL_THRD_ERROR;
+    AcquireSRWLockExclusive(&rwlock->srw);
+    return HAL_THRD_SUCCESS;
+}
+
+int hal_rwlock_trywrlock(hal_rwlock_t *rwlock) {
+    if (!rwlock)
+        return HAL_THRD_ERROR;
+    return TryAcquireSRWLockExclusive(&rwlock->srw) ? HAL_THRD_SUCCESS : HAL_THRD_BUSY;
+}
+
+int hal_rwlock_wrunlock(hal_rwlock_t *rwlock) {
+    if (!rwlock)
+        return HAL_THRD_ERROR;
+    ReleaseSRWLockExclusive(&rwlock->srw);
+    return HAL_THRD_SUCCESS;
+}
+#else
+void hal_rwlock_destroy(hal_rwlock_t *rwlock) {
+    assert(rwlock);
+    DeleteCriticalSection(&rwlock->cs);
+}
+
+int hal_rwlock_init(hal_rwlock_t *rwlock, int type) {
+    if (!rwlock || (type != HAL_RWLOCK_PLAIN && type != HAL_RWLOCK_PREFER_WRITER))
+        return HAL_THRD_ERROR;
+    InitializeCriticalSection(&rwlock->cs);
+    return HAL_THRD_SUCCESS;
+}
+
+int hal_rwlock_rdlock(hal_rwlock_t *rwlock) {
+    if (!rwlock)
+        return HAL_THRD_ERROR;
+    EnterCriticalSection(&rwlock->cs);
+    return HAL_THRD_SUCCESS;
+}
+
+int hal_rwlock_tryrdlock(hal_rwlock_t *rwlock) {
+    if (!rwlock)
+        return HAL_THRD_ERROR;
+    return TryEnterCriticalSection(&rwlock->cs) ? HAL_THRD_SUCCESS : HAL_THRD_BUSY;
+}
+
+int hal_rwlock_rdunlock(hal_rwlock_t *rwlock) {
+    if (!rwlock)
+        return HAL_THRD_ERROR;
+    LeaveCriticalSection(&rwlock->cs);
+    return HAL_THRD_SUCCESS;
+}
+
+int hal_rwlock_wrlock(hal_rwlock_t *rwlock) {
+    return hal_rwlock_rdlock(rwlock);
+}
+
+int hal_rwlock_trywrlock(hal_rwlock_t *rwlock) {
+    return hal_rwlock_tryrdlock(rwlock);
+}
+
+int hal_rwlock_wrunlock(hal_rwlock_t *rwlock) {
+    return hal_rwlock_rdunlock(rwlock);
+}
+#endif
+
+/* Spins before parking, roughly the cost of a kernel round trip */
+#define HAL_LOCK_SPIN 100
+
+void hal_lock_lock_slow(hal_lock_t *lock) {
+    for (int i = 0; i < HAL_LOCK_SPIN; i++) {
+        int32_t state = hal_atomic_load32(&lock->state, HAL_MEMORY_RELAXED);
+        if (state == 0 && hal_lock_trylock(lock))
+            return;
+        if (state == 2)
+            break;
+        hal_cpu_relax();
+    }
+    while (hal_atomic_exchange32(&lock->state, 2, HAL_MEMORY_ACQUIRE) != 0) {
+#if _WIN32_WINNT >= 0x0602
+        int32_t contended = 2;
+        WaitOnAddress((volatile VOID*)&lock->state.value, &contended, sizeof(contended), INFINITE);
+#else
+        /* WaitOnAddress needs Windows 8 */
+        SwitchToThread();
+#endif
+    }
+}
+
+void hal_lock_unlock_slow(hal_lock_t *lock) {
+#if _WIN32_WINNT >= 0x0602
+    WakeByAddressSingle((PVOID)&lock->state.value);
+#else
+    (void)lock;
+#endif
+}
+
 int hal_thrd_create(hal_thrd_t *thr, thrd_start_t func, void *arg) {
     struct impl_thrd_param *pack;
     uintptr_t handle;
@@ -413,10 +554,55 @@ int hal_timeout(hal_thrd_timeout *xt, int base) {
     if (!xt)
         return 0;
     if (base == TIME_UTC) {
-        xt->sec = time(NULL);
-        xt->nsec = 0;
+        /* FILETIME counts 100ns intervals since 1601 */
+        FILETIME ft;
+        ULARGE_INTEGER t;
+        GetSystemTimeAsFileTime(&ft);
+        t.LowPart = ft.dwLowDateTime;
+        t.HighPart = ft.dwHighDateTime;
+        t.QuadPart -= 116444736000000000ull;
+        xt->sec = (time_t)(t.QuadPart / 10000000);
+        xt->nsec = (long)(t.QuadPart % 10000000) * 100;
+        return base;
+    }
+    if (base == HAL_TIME_MONOTONIC) {
+        uint64_t now = hal_time_now_ns();
+        xt->sec = (time_t)(now / HAL_NSEC_PER_SEC);
+        xt->nsec = (long)(now % HAL_NSEC_PER_SEC);
         return base;
     }
     return 0;
 }
+
+int hal_timeout_after(hal_thrd_timeout *xt, uint64_t ns) {
+    if (!xt)
+        return HAL_THRD_ERROR;
+    uint64_t deadline = hal_time_now_ns() + ns;
+    xt->sec = (time_t)(deadline / HAL_NSEC_PER_SEC);
+    xt->nsec = (long)(deadline % HAL_NSEC_PER_SEC);
+    return HAL_THRD_SUCCESS;
+}
+
+uint64_t hal_time_ticks(void) {
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)counter.QuadPart;
+}
+
+uint64_t hal_time_frequency(void) {
+    /* Fixed at boot, safe to cache without a lock */
+    static volatile LONGLONG frequency = 0;
+    if (!frequency) {
+        LARGE_INTEGER f;
+        QueryPerformanceFrequency(&f);
+        frequency = f.QuadPart;
+    }
+    return (uint64_t)frequency;
+}
+
+uint64_t hal_time_now_ns(void) {
+    uint64_t ticks = hal_time_ticks(), frequency = hal_time_frequency();
+    /* Split the multiply so ticks * 1e9 can't overflow */
+    return ticks / frequency * HAL_NSEC_PER_SEC + ticks % frequency * HAL_NSEC_PER_SEC / frequency;
+}
 #endif // HAL_NO_THREADS